@@ -0,0 +1,128 @@
+import argparse
+import os
+import re
+import struct
+import sys
+
+# Decodes a dump of the easyWifi trace (/trace route or easyWifi.dumpTrace()) into a timeline.
+# Event and state names are read from the library headers, so they never drift from the firmware.
+src_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), "src")
+
+HEADER = struct.Struct("<IBBHII")  # TraceDumpHeader
+RECORD = struct.Struct("<IBBHI")   # TraceRecord
+MAGIC = 0x52545745
+VERSION = 1
+HEX_BEGIN = "--- easyWifi trace ---"
+HEX_END = "--- end of trace ---"
+
+def fnv1a(text):
+    value = 2166136261
+    for byte in text.encode("utf-8"):
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+# Values of an enum class, in declaration order, explicit values like ERROR = -1 are honored
+def read_enum(header, name):
+    with open(os.path.join(src_dir, header)) as f:
+        text = f.read()
+    match = re.search(r"enum class " + name + r"\b[^{]*\{(.*?)\};", text, flags=re.S)
+    if not match:
+        sys.exit(f"enum {name} not found in {header}")
+    values = {}
+    value = 0
+    for line in match.group(1).splitlines():
+        line = line.split("//")[0].strip().rstrip(",")
+        if not line:
+            continue
+        if "=" in line:
+            line, number = (part.strip() for part in line.split("="))
+            value = int(number, 0)
+        values[value & 0xFF] = line  # Stored as uint8_t on the device
+        value += 1
+    return values
+
+EVENTS = read_enum("easyWifiTrace.h", "TRACE_EVENT")
+WIFI_STATUS = read_enum("easyWifi.h", "WIFI_STATUS")
+SCAN_STATUS = read_enum("easyWifi.h", "SCAN_STATUS")
+SCAN_PROFILE = read_enum("easyWifi.h", "SCAN_PROFILE")
+PORTAL_COMMAND = read_enum("easyWifi.h", "PORTAL_COMMAND")
+ROUTE = read_enum("easyWifiMetrics.h", "ROUTE")
+CONNECT_FAILURE = read_enum("easyWifiReconnect.h", "CONNECT_FAILURE")
+SCAN_FAILURES = {0: "not started", 1: "driver failed", 2: "timed out"}
+WL_STATUS = {0: "WL_IDLE_STATUS", 1: "WL_NO_SSID_AVAIL", 2: "WL_SCAN_COMPLETED", 3: "WL_CONNECTED",
+             4: "WL_CONNECT_FAILED", 5: "WL_CONNECTION_LOST", 6: "WL_DISCONNECTED", 255: "WL_NO_SHIELD"}
+
+def signed8(value):
+    value &= 0xFF
+    return value - 256 if value > 127 else value
+
+def describe(event, arg8, arg16, arg32, ssids):
+    ssid = lambda: ssids.get(arg32, f"ssid#{arg32:08x}")
+    details = {
+        "WIFI_STATE": lambda: WIFI_STATUS.get(arg8, arg8),
+        "SCAN_STATE": lambda: SCAN_STATUS.get(arg8, arg8),
+        "SCAN_START": lambda: f"{SCAN_PROFILE.get(arg8, arg8)} profile, {arg16} steps",
+        "SCAN_STEP": lambda: f"step {arg8}, channel {arg16 or 'all'}",
+        "SCAN_DONE": lambda: f"{arg8} networks, generation {arg32}",
+        "SCAN_FAILED": lambda: SCAN_FAILURES.get(arg8, arg8),
+        "CONNECT_START": lambda: f"{ssid()}{f' fast on channel {arg16}' if arg8 else ''}",
+        "CONNECT_DONE": lambda: f"in {arg32} ms",
+        "CONNECT_FAILED": lambda: f"{ssid()}, {WL_STATUS.get(arg8, arg8)}",
+        "RECONNECT": lambda: f"{arg8} failed rounds, {CONNECT_FAILURE.get(arg16, arg16)}, " +
+                             (f"retry in {arg32} ms" if arg32 else "opening the portal"),
+        "PORTAL_STOP": lambda: WIFI_STATUS.get(arg8, arg8),
+        "REQUEST": lambda: ROUTE.get(arg8, arg8),
+        "COMMAND": lambda: PORTAL_COMMAND.get(arg8, arg8),
+        "NVS_READ": lambda: f"{arg8} networks",
+        "NVS_WRITE": lambda: f"{arg8} networks, {arg16} bytes{'' if arg32 else ', FAILED'}",
+        "ROAM_SCAN": lambda: f"average {signed8(arg8)} dBm",
+        "ROAM": lambda: f"from {signed8(arg8)} dBm to {signed8(arg32)} dBm on channel {arg16}",
+    }
+    return str(details[event]()) if event in details else ""
+
+# Raw dumps start with the magic, serial dumps are hex between the marker lines
+def read_dump(data):
+    if len(data) >= 4 and struct.unpack_from("<I", data)[0] == MAGIC:
+        return data
+    text = data.decode("utf-8", errors="replace")
+    start = text.find(HEX_BEGIN)
+    end = text.find(HEX_END, start)
+    if start < 0 or end < 0:
+        sys.exit("No trace found, expected a raw dump or the hex printed by dumpTrace()")
+    return bytes.fromhex(re.sub(r"[^0-9a-fA-F]", "", text[start + len(HEX_BEGIN):end]))
+
+def decode(data, ssids):
+    magic, version, record_size, count, recorded, now = HEADER.unpack_from(data)
+    if magic != MAGIC or version != VERSION or record_size != RECORD.size:
+        sys.exit(f"Unsupported trace: version {version}, {record_size} bytes per record")
+
+    print(f"{count} of {recorded} records since boot, {recorded - count} overwritten")
+    first = previous = None
+    for i in range(count):
+        time, event, arg8, arg16, arg32 = RECORD.unpack_from(data, HEADER.size + i * RECORD.size)
+        if first is None:
+            first = previous = time
+        elapsed = ((time - first) & 0xFFFFFFFF) / 1000  # micros() wraps, differences don't
+        delta = ((time - previous) & 0xFFFFFFFF) / 1000
+        torn = " (torn?)" if delta > 3600000 else ""  # Written while dumping, time went backwards
+        name = EVENTS.get(event, f"EVENT_{event}")
+        print(f"{elapsed:12.3f} ms  +{delta:10.3f}  {name:<18} {describe(name, arg8, arg16, arg32, ssids)}{torn}")
+        previous = time
+    if count:
+        print(f"dumped {((now - previous) & 0xFFFFFFFF) / 1000:.3f} ms after the last record")
+
+def main():
+    parser = argparse.ArgumentParser(description="Decodes an easyWifi trace dump into a timeline")
+    parser.add_argument("dump", nargs="?", help="raw dump from /trace or a serial log with dumpTrace() output, stdin if omitted")
+    parser.add_argument("--ssid", action="append", default=[], help="name networks by SSID instead of their hash, can be repeated")
+    args = parser.parse_args()
+
+    if args.dump:
+        with open(args.dump, "rb") as f:
+            data = f.read()
+    else:
+        data = sys.stdin.buffer.read()
+
+    decode(read_dump(data), {fnv1a(ssid): ssid for ssid in args.ssid})
+
+main()
@@ -10,15 +10,34 @@
 void setup() {
   Serial.begin(115200);
 
+  // Optional: stored networks that fail are retried with backoff, the portal only opens after some failed rounds
+  // 0 never opens it, 1 opens it right away. A button can still call easyWifi.startCaptivePortal() at any time
+  // easyWifi.set_ReconnectPolicy(EASYWIFI::CONNECT_FAILURE::NOT_FOUND, 10);
+
+  // Optional: open the portal right at boot, stored networks are tried meanwhile and it closes once connected
+  // easyWifi.set_PortalFirst(true);
+
+  // Optional: with several APs of the same network, move to a closer one when the signal drops below -75 dBm
+  // easyWifi.set_Roaming(true);
+
   // Example 1: Use default Captive Portal settings 
   easyWifi.setup();
 
   // Example 2: Customize all at once
   // easyWifi.setup("MyESP32", "12345678", SHUTDOWN_TIMEOUT);
+
+  // Optional: setup() and update() never block, get notified when a connection attempt ends
+  // easyWifi.onConnectionResult([](EASYWIFI::WIFI_STATUS status){
+  //   Serial.println(status == EASYWIFI::WIFI_STATUS::CONNECTED ? "Connected" : "Failed");
+  // });
 }
 
 void loop() {
   easyWifi.update(); //Just like that
+
+  // Optional: print the event trace on demand, decode the copied output with decode_trace.py
+  // if(Serial.read() == 't') easyWifi.dumpTrace(Serial);
+
   //.... Your code here
   delay(10);
 }
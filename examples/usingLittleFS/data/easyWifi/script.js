@@ -5,6 +5,11 @@
   let isConnecting = false;    // Indicates if a connection attempt is in progress
   let scanAttempts = 0;        // Tracks the number of scan attempts
   const maxScanAttempts = 5;   // Maximum number of scan retries
+  let isPushConnected = false; // Server pushes state changes on /events, polling becomes a slow fallback
+  const pollTimers = { scan: null, wifi: null };
+  let scanGeneration = 0;      // Scan the shown list comes from, lets the server answer with 304 or only the changes
+  let knownNetworks = [];      // Last rendered list, deltas are applied on top of it
+  let connectSession = '';     // Token of our connection attempt, other phones may be using the portal too
   
   const elements = {
     list: document.getElementById('wifi-list'),
@@ -53,8 +58,9 @@
   
       // If the backend responds with OK, wait for the connection to establish
       if (response.ok) {
+        connectSession = response.headers.get('X-Session') || '';
         showMsg(message);
-        setTimeout(checkConnectionStatus, 3000);
+        poll('wifi', checkConnectionStatus);
       } else {
         // Error saving network details
         showMsg(message, 'error');
@@ -86,21 +92,35 @@
       }
   
       // Check the scan status
-      const res_scanStatus = await fetch('/scan-status');
+      const res_scanStatus = await fetch(scanGeneration ? `/scan-status?since=${scanGeneration}` : '/scan-status');
       let networks;
   
       switch (res_scanStatus.status) {
-        case 202: // Scan in progress, wait 3 seconds and retry
-          elements.list.innerHTML = '<div class="scanning">Scanning in progress...</div>';
-          setTimeout(scanNetworks, 3000);
+        case 202: // Scan in progress, wait for the push event or retry in a few seconds
+          if ((res_scanStatus.headers.get('Content-Type') || '').startsWith('application/json')) {
+            // Last results, shown until the new scan replaces them
+            const body = await res_scanStatus.json();
+            scanGeneration = Number(res_scanStatus.headers.get('X-Scan-Generation')) || 0;
+            renderNetworks(Array.isArray(body) ? body : applyDelta(knownNetworks, body));
+          } else if (!knownNetworks.length) {
+            elements.list.innerHTML = '<div class="scanning">Scanning in progress...</div>';
+          }
+          poll('scan', scanNetworks);
           return;
   
         case 500: // Scan error
           stopScan();
           throw new Error(await res_scanStatus.text());
   
-        case 200: // Scan completed successfully
-          networks = await res_scanStatus.json();
+        case 200: // Scan completed successfully, full list or only the changes since our generation
+          const body = await res_scanStatus.json();
+          networks = Array.isArray(body) ? body : applyDelta(knownNetworks, body);
+          scanGeneration = Number(res_scanStatus.headers.get('X-Scan-Generation')) || 0;
+          stopScan();
+          break;
+
+        case 304: // Same results we already show
+          networks = knownNetworks;
           stopScan();
           break;
   
@@ -109,24 +129,7 @@
           throw new Error(`Unexpected status code: ${res_scanStatus.status}`);
       }
   
-      // If no networks were found, retry up to the maximum limit
-      if (networks.length === 0) {
-        scanAttempts++;
-        if (scanAttempts >= maxScanAttempts) {
-          elements.list.innerHTML = '<div class="error">No networks found. Please try again later.</div>';
-          elements.scanBtn.classList.remove('loading');
-          return;
-        }
-        setTimeout(scanNetworks, 3000);
-        return;
-      }
-  
-      // Networks found! Render the network list
-      elements.list.innerHTML = '';
-      networks.forEach(network => {
-        elements.list.appendChild(createNetworkElement(network));
-      });
-      scanAttempts = 0; // Reset the retry counter
+      renderNetworks(networks);
   
     } catch (error) {
       // Handle fetch or backend status errors
@@ -141,16 +144,17 @@
    */
   async function checkConnectionStatus() {
     try {
-      const response = await fetch('/wifi-status');
+      const response = await fetch(connectSession ? `/wifi-status?session=${connectSession}` : '/wifi-status');
       const message = await response.text();
   
       switch (response.status) {
         case 202: // Connection in progress
           showMsg(message, '', 6000); // Display for a longer time
-          setTimeout(checkConnectionStatus, 3000);
+          poll('wifi', checkConnectionStatus);
           break;
   
         case 500: // Connection error
+        case 410: // Someone else started another connection after ours
           showMsg(message, 'error');
           resetConnectState('Connect');
           break;
@@ -173,9 +177,86 @@
     }
   }
   
+  /**
+   * Listens to `/events`, the server pushes scan results and status changes as soon as they happen.
+   * If the browser has no EventSource or the stream drops, polling keeps working as before.
+   */
+  function listenEvents() {
+    if (!window.EventSource) return;
+
+    const source = new EventSource('/events');
+    source.onopen = () => { isPushConnected = true; };
+    source.onerror = () => { isPushConnected = false; }; // Browser reconnects by itself
+
+    // Scan results, sent before the "scan" FINISHED event when they fit in a single event
+    source.addEventListener('networks', (e) => {
+      if (!isScanning) return;
+      clearTimeout(pollTimers.scan);
+      stopScan();
+      scanGeneration = Number(e.lastEventId) || 0;
+      renderNetworks(JSON.parse(e.data));
+    });
+
+    // Results were too big to be pushed, fetch them now instead of waiting the poll
+    source.addEventListener('scan', (e) => {
+      if (!isScanning || e.data !== 'FINISHED') return;
+      clearTimeout(pollTimers.scan);
+      scanNetworks();
+    });
+
+    source.addEventListener('wifi', (e) => {
+      if (!isConnecting || (e.data !== 'CONNECTED' && e.data !== 'ERROR')) return;
+      clearTimeout(pollTimers.wifi);
+      checkConnectionStatus();
+    });
+  }
+
   /*====================================================================
     SUPPORTING FUNCTIONS
     ====================================================================*/
+
+  /**
+   * Schedules the next status check, replacing any pending one of the same kind.
+   * Push events make polls rare, they only cover a lost event.
+   */
+  function poll(kind, callback) {
+    clearTimeout(pollTimers[kind]);
+    pollTimers[kind] = setTimeout(callback, isPushConnected ? 10000 : 3000);
+  }
+
+  /**
+   * Applies a {added, changed, removed} delta from `/scan-status?since=` to the shown list, strongest first.
+   */
+  function applyDelta(networks, delta) {
+    const replaced = new Set([...delta.removed, ...delta.changed.map(network => network.ssid)]);
+    return networks.filter(network => !replaced.has(network.ssid))
+      .concat(delta.added, delta.changed)
+      .sort((a, b) => b.rssi - a.rssi);
+  }
+
+  /**
+   * Renders the scan results, retrying the scan up to the maximum limit if the list is empty.
+   */
+  function renderNetworks(networks) {
+    knownNetworks = networks;
+    if (networks.length === 0) {
+      scanAttempts++;
+      if (scanAttempts >= maxScanAttempts) {
+        elements.list.innerHTML = '<div class="error">No networks found. Please try again later.</div>';
+        elements.scanBtn.classList.remove('loading');
+        return;
+      }
+      poll('scan', scanNetworks);
+      return;
+    }
+
+    // Networks found! Render the network list
+    elements.list.innerHTML = '';
+    networks.forEach(network => {
+      elements.list.appendChild(createNetworkElement(network));
+    });
+    scanAttempts = 0; // Reset the retry counter
+  }
   
   /**
    * Creates an HTML element to display a found network with icon and signal info.
@@ -307,7 +388,7 @@
   });
 
   // Trigger scanning on "Scan" button click
-  elements.scanBtn.addEventListener('click', scanNetworks);
+  elements.scanBtn.addEventListener('click', () => scanNetworks());
   
   // Handle "Cancel" button click in the password modal
   elements.cancelBtn.addEventListener('click', () => {
@@ -324,4 +405,5 @@
   });
   
   // Automatically start scanning when the page loads
+  listenEvents();
   scanNetworks(true);
\ No newline at end of file
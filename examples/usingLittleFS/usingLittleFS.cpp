@@ -3,6 +3,8 @@
 ! Don't Forget to include the /data/easyWifi folder in your root folder
 ? You can copy the data folder in my repo https://github.com/Arthur5492/EasyWiFiPortal-ESP32/
 ? paste in the root of your platformio project, Will not work for SPIFFS
+? Optional: run "python gen_frontend_header.py --gz-dir data/easyWifi" before uploading,
+? the minified .gz files are served instead of the originals and are ~4x smaller
 *
 ! Don't Forget to change your FileSystem to LittleFS 
 *Please read the docs:
@@ -1,5 +1,8 @@
+import argparse
 import gzip
+import hashlib
 import os
+import re
 
 # Input and output directories
 script_dir = os.getcwd()
@@ -7,45 +10,108 @@ input_path = os.path.join(script_dir, "data/easyWifi")  # Folder where the input
 output_path = os.path.join(script_dir, "src")            # Folder where the .h file will be saved
 output_header = os.path.join(output_path, "frontend.h")  # Name of the final .h file
 
-# Function to compress a file
+# Route and MIME type of each file, index is served at the root
+MIME_TYPES = {
+    ".htm": "text/html",
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "text/javascript",
+    ".svg": "image/svg+xml",
+    ".ico": "image/x-icon",
+    ".png": "image/png",
+    ".json": "application/json",
+}
+INDEX_FILES = ("index.htm", "index.html")
+
+# Conservative minifiers, they only drop comments and indentation so they can't break the code
+def minify_css(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"\s+", " ", text)
+    text = re.sub(r"\s*([{};,>])\s*", r"\1", text)
+    text = re.sub(r":\s+", ":", text)
+    return text.replace(";}", "}").strip()
+
+def minify_js(text):
+    text = re.sub(r"^\s*/\*.*?\*/", "", text, flags=re.S | re.M)  # Block comments starting a line
+    lines = (line.strip() for line in text.splitlines())
+    return "\n".join(line for line in lines if line and not line.startswith("//"))
+
+def minify_html(text):
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    lines = (line.strip() for line in text.splitlines())
+    return "\n".join(line for line in lines if line)
+
+MINIFIERS = {".css": minify_css, ".js": minify_js, ".htm": minify_html, ".html": minify_html}
+
+# Function to minify and compress a file, mtime is fixed so the output only changes with the content
 def compress_file(file_path):
-    compressed_path = file_path + ".gz"
+    extension = os.path.splitext(file_path)[1]
     with open(file_path, "rb") as f_in:
-        with gzip.open(compressed_path, "wb") as f_out:
-            f_out.writelines(f_in)
-    return compressed_path
-
-# Function to convert a .gz file to a C array
-def file_to_c_array(file_path):
-    array_name = os.path.basename(file_path).replace(".", "_").replace("-", "_")
-    with open(file_path, "rb") as f:
-        data = f.read()
+        data = f_in.read()
+    if extension in MINIFIERS:
+        data = MINIFIERS[extension](data.decode("utf-8")).encode("utf-8")
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+# Function to convert compressed data to a C array
+def data_to_c_array(array_name, data):
     byte_array = ", ".join(f"0x{byte:02x}" for byte in data)
-    length = len(data)
-    c_array = f"const uint8_t {array_name}[] PROGMEM= {{ {byte_array} }};\n"
-    c_array += f"unsigned int {array_name}_len = {length};\n\n"
-    return c_array
+    return f"static const uint8_t {array_name}[] PROGMEM = {{ {byte_array} }};\n\n"
+
+def asset_route(file_name):
+    return "/" if file_name in INDEX_FILES else "/" + file_name
+
+# LittleFS mode: writes a .gz sibling next to each file, served instead of the original
+def write_gzip_siblings(directory):
+    for file in sorted(os.listdir(directory)):
+        file_path = os.path.join(directory, file)
+        if not os.path.isfile(file_path) or file.endswith(".gz"):
+            continue
+        print(f"Compressing: {file}")
+        with open(file_path + ".gz", "wb") as f_out:
+            f_out.write(compress_file(file_path))
 
 # Main process
-def main():
+def generate_header():
     # Ensure the output directory exists
     os.makedirs(output_path, exist_ok=True)
 
-    # Get files from the input directory
-    files = [os.path.join(input_path, f) for f in os.listdir(input_path) if os.path.isfile(os.path.join(input_path, f))]
+    # Get files from the input directory, sorted so the header is reproducible
+    files = sorted(f for f in os.listdir(input_path)
+                   if os.path.isfile(os.path.join(input_path, f)) and not f.endswith(".gz"))
     if not files:
         print("No files found in the input directory.")
         return
 
     # Generate the .h file
+    table = []
     with open(output_header, "w") as header_file:
-        header_file.write("#include <pgmspace.h> //for PROGMEM\n\n")
+        header_file.write("//Generated by gen_frontend_header.py, do not edit\n")
+        header_file.write("#pragma once\n\n")
+        header_file.write("#include <pgmspace.h> //for PROGMEM\n")
+        header_file.write("#include \"easyWifi.h\" //for StaticAsset\n\n")
+        header_file.write("namespace EASYWIFI{\n\n")
         for file in files:
             print(f"Processing: {file}")
-            compressed_file = compress_file(file)
-            c_array = file_to_c_array(compressed_file)
-            header_file.write(c_array)
-            os.remove(compressed_file)  # Remove the temporary .gz file
+            array_name = file.replace(".", "_").replace("-", "_") + "_gz"
+            data = compress_file(os.path.join(input_path, file))
+            etag = '\\"' + hashlib.sha256(data).hexdigest()[:16] + '\\"'  # Strong ETag, changes with the content
+            mime = MIME_TYPES.get(os.path.splitext(file)[1], "application/octet-stream")
+            header_file.write(data_to_c_array(array_name, data))
+            table.append(f"  {{ \"{asset_route(file)}\", \"{mime}\", {array_name}, sizeof({array_name}), \"{etag}\" }},\n")
+
+        header_file.write("static constexpr StaticAsset FRONTEND_ASSETS[] = {\n")
+        header_file.writelines(table)
+        header_file.write("};\n\n};\n")
         print(f"Header file generated: {output_header}")
 
-main()
\ No newline at end of file
+def main():
+    parser = argparse.ArgumentParser(description="Builds the EasyWifi frontend")
+    parser.add_argument("--gz-dir", help="write pre-compressed .gz files for LittleFS into this folder instead of frontend.h")
+    args = parser.parse_args()
+
+    if args.gz_dir:
+        write_gzip_siblings(args.gz_dir)
+    else:
+        generate_header()
+
+main()
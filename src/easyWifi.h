@@ -6,27 +6,44 @@
 #include <DNSServer.h> //Local DNS Server used for redirecting all requests to the configuration portal
 #include <Preferences.h> //To store Wi-Fi Credentials
 #include <esp_log.h> //For logging
+#include <new> //Placement new for EASYWIFI_STATIC_ARENA
+#include <atomic> //States shared with the web server task
+#include <utility> //swap
+#ifdef EASYWIFI_TASK
+  #include <mutex> //State shared between loop() and the easyWifi task
+#endif
+#include <inttypes.h> //PRIu32, uint32_t is unsigned long on some cores
+#include "easyWifiScan.h" //Compact copy of the scan results
+#include "easyWifiJson.h" //Streaming JSON for scan results
+#include "easyWifiCredentials.h" //Multiple stored networks
+#include "easyWifiMetrics.h" //Timings and counters, always recorded
+#include "easyWifiReconnect.h" //Backoff between reconnect rounds
+#include "easyWifiQueue.h" //Requests from the web server task to update()
+#include "easyWifiTrace.h" //Binary event trace, recorded unless EASYWIFI_NO_TRACE
+#include "easyWifiRoaming.h" //When to move to a better AP of the same network
+#include "easyWifiConfig.h" //Knobs and features of this build
+
+#ifdef EASYWIFI_ASYNC_DNS
+  #include "easyWifiDns.h" //DNS answered from its own task, independent of update() rate
+#endif
 
 #ifdef EASYWIFI_LITTLEFS 
   #include <LittleFS.h>
+  #include "easyWifiFileCache.h" //Keeps the hottest portal files in RAM
+  #define LITTLEFS_ROOT "/easyWifi" //Folder with the portal files, index.htm is served at /
 #endif
 
-//TODO: Implement websocket method instead of simple https requests
-//TODO: Implement multi wifi stored, perhaps with a wifiParam struct or a json in littlefs(tip: setting up scanNetworks first and then check if any ssid stored matches with networks discovered)
-
-#define AP_DEFAULT_SSID "Configure ESP32"
-#define AP_DEFAULT_PASSWORD ""
-#define AP_DEFAULT_TIMEOUT 300000 //5 minutes default(300000)
-
-//SSID and Password default max length according to WLAN standart
-#define SSID_MAX_LENGTH     32
-#define PASSWORD_MAX_LENGTH 64
-
 
 namespace EASYWIFI{
 
 static const char* APP = "EasyWifi";
 
+#ifdef EASYWIFI_ASYNC_DNS
+  typedef CaptiveDnsServer PortalDnsServer;
+#else
+  typedef DNSServer PortalDnsServer;
+#endif
+
 enum class WIFI_STATUS{
   ERROR = -1,
   IDLE,
@@ -42,6 +59,117 @@ enum class SCAN_STATUS{
   FINISHED,
 };
 
+inline const char* toString(WIFI_STATUS status)
+{
+  switch(status)
+  {
+    case WIFI_STATUS::ERROR:            return "ERROR";
+    case WIFI_STATUS::IDLE:             return "IDLE";
+    case WIFI_STATUS::READY_TO_CONNECT: return "READY_TO_CONNECT";
+    case WIFI_STATUS::CONNECTING:       return "CONNECTING";
+    case WIFI_STATUS::CONNECTED:        return "CONNECTED";
+  }
+  return "UNKNOWN";
+}
+
+enum class SCAN_PROFILE{
+  FULL,         //Every channel, every SSID, needed to list networks on the portal
+  STORED_SSIDS, //One directed probe per stored network with a known channel, a full pass only if they all miss
+  CHANNELS,     //Only the channels set with set_ScanChannels(), active or passive each
+  CONNECTED_SSID, //Directed probe of the network in use on every channel, for roaming
+};
+
+inline const char* toString(SCAN_PROFILE profile)
+{
+  switch(profile)
+  {
+    case SCAN_PROFILE::FULL:         return "FULL";
+    case SCAN_PROFILE::STORED_SSIDS: return "STORED_SSIDS";
+    case SCAN_PROFILE::CHANNELS:     return "CHANNELS";
+    case SCAN_PROFILE::CONNECTED_SSID: return "CONNECTED_SSID";
+  }
+  return "UNKNOWN";
+}
+
+//Results of a finished scan, published by update() as a whole
+struct ScanSnapshot
+{
+  ScanTable table; //Deduplicated by SSID, strongest first
+  uint32_t generation = 0; //Increased on every finished scan, 0 before the first one
+  uint32_t hash = 0; //Content hash of table, sent as ETag
+  SCAN_PROFILE profile = SCAN_PROFILE::FULL;
+  unsigned long finishedTime = 0;
+};
+
+#define SCAN_SLOT_WRITING 0xFF //Users of a slot while update() fills it
+
+//One of the two preallocated scans: the published one, and the previous one that answers ?since= with a delta
+struct ScanSlot
+{
+  ScanSnapshot snapshot;
+  std::atomic<uint8_t> users{0}; //Responses still reading it, update() only rewrites a slot with none
+};
+
+//Holds a published scan unchanged for as long as it lives, e.g. inside a response streaming it. Empty if nothing was held
+class ScanSnapshotRef
+{
+  public:
+    ScanSnapshotRef() = default;
+    explicit ScanSnapshotRef(ScanSlot *slot) : _slot(slot) {}; //The slot was already held for this reference
+    ScanSnapshotRef(const ScanSnapshotRef &other) : _slot(other._slot) { if(_slot) _slot->users++; };
+    ScanSnapshotRef& operator=(ScanSnapshotRef other) { std::swap(_slot, other._slot); return *this; };
+    ~ScanSnapshotRef() { if(_slot) _slot->users--; };
+
+    explicit operator bool() const { return _slot != nullptr; };
+    const ScanSnapshot& operator*() const { return _slot->snapshot; };
+    const ScanSnapshot* operator->() const { return &_slot->snapshot; };
+
+  private:
+    ScanSlot *_slot = nullptr;
+};
+
+inline const char* toString(SCAN_STATUS status)
+{
+  switch(status)
+  {
+    case SCAN_STATUS::NOT_RUNNING:   return "NOT_RUNNING";
+    case SCAN_STATUS::READY_TO_SCAN: return "READY_TO_SCAN";
+    case SCAN_STATUS::RUNNING:       return "RUNNING";
+    case SCAN_STATUS::FINISHED:      return "FINISHED";
+  }
+  return "UNKNOWN";
+}
+
+typedef std::function<void(WIFI_STATUS status)> ConnectionResultHandler;
+
+//Gzipped frontend file embedded in flash, table is generated by gen_frontend_header.py
+struct StaticAsset
+{
+  const char* path;
+  const char* mimeType;
+  const uint8_t* data;
+  size_t length;
+  const char* etag; //Content hash, quoted as sent on the ETag header
+};
+
+#ifdef EASYWIFI_TASK
+//Held by update() and by every public method that changes state, so loop() never runs them halfway through
+//each other. Recursive, update() calls public methods like logoutCaptivePortal() itself
+typedef std::recursive_mutex StateMutex;
+typedef std::lock_guard<std::recursive_mutex> StateLock;
+#else
+//update() and the public methods all run on loop(), nothing to lock
+struct StateMutex {};
+struct StateLock { explicit StateLock(StateMutex&) {}; };
+#endif
+
+//Portal requests handed from the web server task to update()
+enum class PORTAL_COMMAND : uint8_t{
+  START_SCAN,  //Scan unless results are fresh or a scan is running
+  CONNECT,     //Connect to the network in the staging buffer
+  CLEAR_ERROR, //Failed connection was reported to the client
+};
+
 class EasyWifi
 {
   public:
@@ -53,73 +181,245 @@ class EasyWifi
     ///@param timeout Timeout in ms for captive portal
     void setup(const char* ssid=nullptr, const char* passwd=nullptr, unsigned long timeout=0); 
 
-    void update(); //Check all events
-    bool connectWifi();
-    void scanNetworks();
+    void update(); //Check all events, does nothing when called outside the EASYWIFI_TASK task
+    bool connectWifi(); //Starts a non-blocking connection attempt, checkConnection() finishes it
+    void checkConnection(); //Non-blocking poll of the running connection attempt, called from update()
+    ///@param profile Narrow profiles are much faster but their results are not shown on the portal
+    void scanNetworks(SCAN_PROFILE profile=SCAN_PROFILE::FULL); //Starts an async scan, results are collected by checkScanResult()
+    void checkScanResult(); //Non-blocking poll of the running scan, called from update()
+    bool isScanCacheValid(const ScanSnapshot &scan);
+    ScanSnapshotRef readScanResults(); //Published results from any task, held without copying or allocating
+    ScanSnapshotRef readPreviousScan(uint32_t generation); //The scan before the published one, empty if it is not that generation
+    void matchStoredNetworks(); //Ranks stored networks against scan results and starts connecting
+    bool connectNextCandidate();
+    void connectStoredNetworks(); //Starts a round over every stored network
+
+    //Stored networks
+    ///@param priority Higher priority networks are preferred over similar signals
+    bool addCredential(const char* ssid, const char* passwd, uint8_t priority=0);
+    bool removeCredential(const char* ssid);
 
     //Captive Portal
     void startCaptivePortal(); 
     void logoutCaptivePortal();
     void checkCaptivePortalTimeout();
     
-    String sendJsonNetworks();
+    void sendJsonNetworks(AsyncWebServerRequest *request, const ScanSnapshotRef &scan, bool isPending = false); //Full list, delta for ?since= or 304
+    void sendScanPending(AsyncWebServerRequest *request, const ScanSnapshotRef &scan, const char *message); //202, with the last results if any
 
     //Serve AsyncWebServer Routes
     void serveScanRoutes();
     void serveWifiRoutes();
     void serveStaticRoutes();
+    void serveEventRoutes();
+    void serveMetricsRoutes(); //Only with EASYWIFI_METRICS_ROUTE
+    void serveTraceRoutes(); //Only with EASYWIFI_TRACE_ROUTE
+    void pushStatusEvents(); //Sends state changes to every client on /events
     
     // Web Server Controllers
     void checkScanController(AsyncWebServerRequest *request);
     void SaveWiFiDataController(AsyncWebServerRequest *request);
     void checkWiFiStatusController(AsyncWebServerRequest *request);
     void redirectToIpController(AsyncWebServerRequest *request);
+    void metricsController(AsyncWebServerRequest *request);
+    void traceController(AsyncWebServerRequest *request);
+    bool staticAssetController(AsyncWebServerRequest *request, const char *url);
+    void sendStaticAsset(AsyncWebServerRequest *request, const StaticAsset &asset);
+    bool sendNotModified(AsyncWebServerRequest *request, const char *etag, const char *lastModified=nullptr);
+#ifdef EASYWIFI_LITTLEFS
+    void sendCachedFile(AsyncWebServerRequest *request, const CachedFile &file, const char *mimeType);
+    bool sendFlashFile(AsyncWebServerRequest *request, const char *path, const char *mimeType); //Too big for the cache, false if missing
+#endif
     
     //NVS Functions - (Non-Volatile Storage)
     bool NVS_SaveWifiSettings();
+    bool NVS_SaveCredentials();
     bool NVS_Clear(); 
     bool NVS_RetrieveWifiData();
+    bool NVS_RetrieveLegacyData();
+    void NVS_RemoveLegacyKeys();
     
     //Helpers
+    void buildPortalServers(); //Allocates the server and DNS and registers every route
     void freePointers();
+    bool beginConnection();
+    void finishConnection(bool isConnected);
+    bool startScanStep();
+    void scheduleReconnect();
+    void processCommands(); //Applies what route handlers queued, from update()
+    void checkRoaming(); //Samples the link and starts a roaming scan when it gets weak
+    void finishRoamingScan(); //Moves to the strongest AP found if it is clearly better
 
     //Getters
+    const EasyWifiMetrics& get_Metrics() { return _metrics; };
+    ///@param isHex Hex text that can be copied from a serial monitor, raw bytes otherwise. Both are read by decode_trace.py
+    size_t dumpTrace(Print &out, bool isHex=true) { return _trace.dump(out, isHex); };
     const char* get_ssidStored() { return _ssidStored; };
-    const bool get_isProtected() { return _isProtected; };
+    bool get_isProtected() { return _isProtected; };
     const char* get_passwdStored() { return _passwdStored; };
 
+    uint8_t get_credentialCount() { return _credentials.count(); };
+    const WifiCredential& get_credential(uint8_t index) { return _credentials.get(index); };
+
     SCAN_STATUS get_ScanState() { return _scanStatus; };
     WIFI_STATUS get_WifiState() { return _wifiStatus; };
+#ifdef EASYWIFI_LITTLEFS
+    const FileCache& get_fileCache() { return _fileCache; }; //Hit rate and bytes read from flash
+#endif
+    ///@return Time in ms from connectWifi() to connected on the last successful connection
+    unsigned long get_connectDuration() { return _connectDuration; };
+    ///@return True if the last connection skipped the channel scan using the stored AP
+    bool get_isFastConnect() { return _isFastConnect; };
+    uint8_t get_reconnectFailures() { return _reconnect.get_failures(); };
+
+    //Setters
+    ///@param ttl Time in ms that finished scan results are reused before a new scan is started
+    void set_ScanCacheTTL(unsigned long ttl) { StateLock lock(_stateMutex); _scanCacheTTL = ttl; };
+    ///@param timeout Time in ms before a connection attempt is reported as WIFI_STATUS::ERROR
+    void set_ConnectTimeout(unsigned long timeout) { StateLock lock(_stateMutex); _connectTimeout = timeout; };
+    ///@param dwell Time in ms spent on each channel by a full scan
+    ///@param isPassive Listen for beacons instead of probing, needs a dwell above the beacon interval (~100ms)
+    void set_ScanDwell(uint16_t dwell, bool isPassive=false) { StateLock lock(_stateMutex); _scanDwell = dwell; _isPassiveScan = isPassive; };
+    ///@param channels Channels scanned by SCAN_PROFILE::CHANNELS, in order, up to SCAN_CHANNELS_MAX
+    bool set_ScanChannels(const ScanChannel *channels, uint8_t count);
+    ///@param isPortalFirst Opens the portal at boot even with stored networks, they are tried while it is reachable and it closes once connected.
+    ///Failed rounds are retried with the backoff behind it, a network typed on it replaces the stored one being tried
+    void set_PortalFirst(bool isPortalFirst) { StateLock lock(_stateMutex); _isPortalFirst = isPortalFirst; };
+    ///@param portalAfter Failed rounds in a row ending with this failure before the portal opens, 0 never opens it
+    void set_ReconnectPolicy(CONNECT_FAILURE failure, uint8_t portalAfter);
+    ///@param base Delay in ms after the first failed round, doubled on every following one up to max
+    void set_ReconnectBackoff(uint32_t base, uint32_t max) { StateLock lock(_stateMutex); _reconnect.set_Backoff(base, max); };
+    ///@param seed Same seed gives the same retry delays, randomly seeded in setup() otherwise
+    void set_ReconnectSeed(uint32_t seed) { StateLock lock(_stateMutex); _reconnect.seed(seed); };
+    ///@param isEnabled Watches the signal while connected and moves to a clearly stronger AP of the same network, ignored with EASYWIFI_NO_ROAMING
+    void set_Roaming(bool isEnabled) { StateLock lock(_stateMutex); _isRoamingEnabled = isEnabled; };
+    ///@param threshold Smoothed RSSI in dBm below which a better AP is looked for
+    ///@param hysteresis dB a new AP must beat the current signal by
+    ///@param interval Min time in ms between roaming scans
+    void set_RoamingPolicy(int8_t threshold, uint8_t hysteresis, uint32_t interval) { StateLock lock(_stateMutex); _roaming.set_Policy(threshold, hysteresis, interval); };
+
+    ///@param handler Called once every connection attempt ends, with CONNECTED or ERROR.
+    ///With EASYWIFI_TASK it runs on the easyWifi task holding the state lock, public methods work but waiting on loop() deadlocks
+    void onConnectionResult(ConnectionResultHandler handler) { StateLock lock(_stateMutex); _onConnectionResult = handler; };
     
   private:
     
     // User configs
-    String _CaptivePortalSSID = AP_DEFAULT_SSID; //sry for using String
-    String _CaptivePortalPassword = AP_DEFAULT_PASSWORD;
+    char _CaptivePortalSSID[SSID_MAX_LENGTH+1] = AP_DEFAULT_SSID;
+    char _CaptivePortalPassword[PASSWORD_MAX_LENGTH+1] = AP_DEFAULT_PASSWORD;
     unsigned long _CaptivePortalTimeout = AP_DEFAULT_TIMEOUT;
+    bool _isPortalFirst = false;
 
     // Captive Portal
     AsyncWebServer *_server = nullptr; //Pointer to reduce memory usage
-    DNSServer *_dnsServer = nullptr;
+    PortalDnsServer *_dnsServer = nullptr;
+    AsyncEventSource *_events = nullptr; //Owned by _server
+#ifdef EASYWIFI_STATIC_ARENA
+    //Server and DNS are built once in here and reused, reopening the portal leaves the heap untouched
+    alignas(AsyncWebServer) uint8_t _serverArena[sizeof(AsyncWebServer)];
+    alignas(PortalDnsServer) uint8_t _dnsServerArena[sizeof(PortalDnsServer)];
+#endif
+    SCAN_STATUS _pushedScanStatus = SCAN_STATUS::NOT_RUNNING; //Last states sent on /events
+    WIFI_STATUS _pushedWifiStatus = WIFI_STATUS::IDLE;
+    char _portalHost[16] = {0}; //AP IP, compared with the Host header
+    char _portalUrl[24] = {0}; //Redirect target, built when the portal starts
     unsigned long _serverStartTime = 0;
+    unsigned long _logoutRequestTime = 0;
     bool _isCaptivePortalEnabled = false;
+    bool _isLogoutPending = false;
+#ifdef EASYWIFI_LITTLEFS
+    FileCache _fileCache;
+    bool _isFileSystemMounted = false;
+#endif
     
     // NVS (Stores Wi-Fi Credentials)
     Preferences _wifiDataNVS;
-    char _ssidStored[SSID_MAX_LENGTH] = {0}; //Network SSID
-    char _passwdStored[PASSWORD_MAX_LENGTH] = {0}; //Network Password
+    uint8_t _nvsShadow[CREDENTIAL_RECORD_MAX_SIZE]; //Record as it is in flash, saves are skipped when nothing changed
+    size_t _nvsShadowSize = 0;
+    bool _isNvsShadowValid = false; //False until flash was read or written
+    CredentialStore _credentials; //All known networks
+    char _ssidStored[SSID_MAX_LENGTH + 1] = {0}; //Network SSID, the one being used
+    char _passwdStored[PASSWORD_MAX_LENGTH + 1] = {0}; //Network Password
     bool _isProtected = false; //Network is protected or Open(no password)
+    uint8_t _activeBssid[6] = {0}; //Last AP used by the network, for fast reconnect
+    uint8_t _activeChannel = 0; //0 if unknown
+    bool _isFastConnect = false;
+
+    // Stored networks found on scan, in connection order
+    uint8_t _candidates[CREDENTIALS_MAX];
+    uint8_t _candidateCount = 0;
+    uint8_t _nextCandidate = 0;
+    bool _isMatchPending = false; //Boot scan running to pick a stored network
     
+    EasyWifiMetrics _metrics;
+    void countRequest(ROUTE route) { _metrics.requests[(uint8_t)route]++; _trace.record(TRACE_EVENT::REQUEST, (uint8_t)route); };
+    TraceBuffer _trace;
+    //Every state change goes through these, so each one is traced
+    void setWifiStatus(WIFI_STATUS status) { _wifiStatus = status; _trace.record(TRACE_EVENT::WIFI_STATE, (uint8_t)status); };
+    void setScanStatus(SCAN_STATUS status) { _scanStatus = status; _trace.record(TRACE_EVENT::SCAN_STATE, (uint8_t)status); };
+
     //Helpers
-    int16_t _avaibleNetworks = -1;
-    SCAN_STATUS _scanStatus = SCAN_STATUS::NOT_RUNNING;
-    WIFI_STATUS _wifiStatus = WIFI_STATUS::IDLE;
+    ScanSlot _scanSlots[2]; //Written by publishScanResults() only, other tasks hold them with readScanResults()
+    std::atomic<uint8_t> _publishedSlot{0};
+    const ScanSnapshot& publishedScan() const { return _scanSlots[_publishedSlot.load(std::memory_order_relaxed)].snapshot; }; //From update() only
+    bool publishScanResults();
+    void finishScan();
+    bool _isPublishPending = false; //Scan done, the slot to publish in is still sent by a response
+    ScanTable _pendingScanTable; //Filled by the running scan, published once it finishes
+    unsigned long _scanStartTime = 0; //Start of the current step
+    SCAN_PROFILE _scanProfile = SCAN_PROFILE::FULL;
+    uint8_t _scanStep = 0;
+    uint8_t _scanStepCount = 0;
+    uint8_t _scanTargets[CREDENTIALS_MAX]; //Stored networks with a known channel, one STORED_SSIDS step each
+    uint8_t _scanTargetCount = 0;
+    uint16_t _scanDwell = SCAN_DEFAULT_DWELL;
+    bool _isPassiveScan = false;
+    ScanChannel _scanChannels[SCAN_CHANNELS_MAX];
+    uint8_t _scanChannelCount = 0;
+    uint32_t _scanStartMicros = 0;
+    unsigned long _scanCacheTTL = SCAN_DEFAULT_CACHE_TTL;
+    //Written by update() only, atomic because route handlers read them from the web server task
+    std::atomic<SCAN_STATUS> _scanStatus{SCAN_STATUS::NOT_RUNNING};
+    std::atomic<WIFI_STATUS> _wifiStatus{WIFI_STATUS::IDLE};
+
+    //Route handlers never change state themselves, they queue a command for update()
+    SpscQueue<PORTAL_COMMAND, PORTAL_COMMAND_QUEUE_SIZE> _commands;
+    char _stagedSsid[SSID_MAX_LENGTH+1] = {0}; //Network typed on the portal, owned by the handler until CONNECT is processed
+    char _stagedPasswd[PASSWORD_MAX_LENGTH+1] = {0};
+    bool _stagedIsProtected = false;
+    uint32_t _stagedSession = 0; //Token handed to the client that submitted the staged network
+    std::atomic<uint32_t> _connectSession{0}; //Token of the portal attempt in use, /wifi-status answers only its owner
+    std::atomic<bool> _isPortalAttempt{false}; //Network in use was typed on the portal, not a stored one tried in background
+    std::atomic<bool> _isStagingBusy{false};
+    StateMutex _stateMutex;
+#ifdef EASYWIFI_TASK
+    TaskHandle_t _taskHandle = nullptr;
+    static void taskLoop(void *easyWifi);
+#endif
+    unsigned long _connectStartTime = 0;
+    unsigned long _connectRequestTime = 0;
+    unsigned long _connectDuration = 0;
+    unsigned long _connectTimeout = WIFI_CONNECT_TIMEOUT;
+    //WiFi.status() only changes on driver events, a failure counts once the attempt in use got its own
+    std::atomic<uint32_t> _connectAttempt{0}; //Increased before every WiFi.begin()
+    std::atomic<uint32_t> _failedAttempt{0}; //Attempt in use when the driver last reported STA_DISCONNECTED
+    bool _isEventRegistered = false;
+    ConnectionResultHandler _onConnectionResult = nullptr;
+    ReconnectScheduler _reconnect;
+    CONNECT_FAILURE _roundFailure = CONNECT_FAILURE::NOT_FOUND; //Worst failure of the current round
+    uint8_t _portalAfterFailures[2] = {RECONNECT_NOT_FOUND_PORTAL_AFTER, RECONNECT_AUTH_PORTAL_AFTER};
+    RoamingPolicy _roaming;
+    bool _isRoamingEnabled = false;
+    bool _isRoamScanPending = false; //Scan started by checkRoaming(), finishRoamingScan() reads it
+    bool _isRoamAttempt = false; //Connection in progress is a move to another AP
+    unsigned long _roamSampleTime = 0;
 
     //? Just Constants, ignore them
     static constexpr const char* NVS_NAMESPACE       = "wifiDataNVS";
     static constexpr const char* NVS_KEY_SSID        = "ssid";
     static constexpr const char* NVS_KEY_PASSWD      = "password";
     static constexpr const char* NVS_KEY_ISPROTECTED = "isProtected";
+    static constexpr const char* NVS_KEY_RECORD      = "wifiRecord";
     static constexpr const bool  NVS_READ_WRITE      = false;
     static constexpr const bool  NVS_READ_ONLY       = true;
 };
@@ -127,4 +427,6 @@ class EasyWifi
 };
 
 //Singleton
-extern EASYWIFI::EasyWifi easyWifi;
+#ifndef EASYWIFI_NO_SINGLETON //Without it, declare your own EASYWIFI::EasyWifi
+  extern EASYWIFI::EasyWifi easyWifi;
+#endif
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <Arduino.h>
+#include "easyWifiScan.h" //SCAN_MAX_ENTRIES
+#include "easyWifiCredentials.h" //CREDENTIALS_MAX
+
+/*
+*   Build configuration. Every value can be set from build_flags, e.g. -DCREDENTIALS_MAX=2 -DEASYWIFI_NO_TRACE.
+*   Features left out are checked through BuildConfig in plain ifs, so the compiler drops their
+*   code and the linker drops whatever only they used (AsyncEventSource, legacy NVS readers, ...).
+*/
+
+#ifndef AP_DEFAULT_SSID
+  #define AP_DEFAULT_SSID "Configure ESP32"
+#endif
+#ifndef AP_DEFAULT_PASSWORD
+  #define AP_DEFAULT_PASSWORD ""
+#endif
+#ifndef AP_DEFAULT_TIMEOUT
+  #define AP_DEFAULT_TIMEOUT 300000 //5 minutes default(300000)
+#endif
+
+#define WIFI_CONNECT_TIMEOUT 8000 //Max time a connection attempt stays in CONNECTING
+#define FAST_CONNECT_TIMEOUT 3000 //Attempt on the last known AP/channel, falls back to a full scan after it
+#define PORTAL_LOGOUT_DELAY  2000 //Keeps the portal up after connecting so the user can read the result
+
+#ifndef METRICS_JSON_MAX_LENGTH
+  #define METRICS_JSON_MAX_LENGTH 1280 //Buffer of the /metrics response, on the stack of the web server task
+#endif
+#ifndef EVENT_JSON_MAX_LENGTH
+  #define EVENT_JSON_MAX_LENGTH 1536 //Scan results bigger than this are not pushed, clients fetch /scan-status instead
+#endif
+
+#define SCAN_DEFAULT_CACHE_TTL 15000 //Scan results younger than this are served without rescanning
+#define SCAN_TIMEOUT           15000 //Give up on an async scan that never completes
+#define SCAN_DEFAULT_DWELL     300 //ms per channel of a full scan, same as the Arduino default
+#define SCAN_TARGETED_DWELL    120 //ms per channel of a directed SSID probe, the AP answers within a few ms
+
+#ifndef PORTAL_COMMAND_QUEUE_SIZE
+  #define PORTAL_COMMAND_QUEUE_SIZE 8
+#endif
+
+#ifdef EASYWIFI_TASK //update() runs on its own task, started by setup()
+  #ifndef EASYWIFI_TASK_CORE
+    #define EASYWIFI_TASK_CORE 0 //Same core as the WiFi driver, loop() runs on core 1
+  #endif
+  #ifndef EASYWIFI_TASK_PRIORITY
+    #define EASYWIFI_TASK_PRIORITY 1
+  #endif
+  #ifndef EASYWIFI_TASK_STACK
+    #define EASYWIFI_TASK_STACK 6144
+  #endif
+  #ifndef EASYWIFI_TASK_PERIOD
+    #define EASYWIFI_TASK_PERIOD 10 //ms between update() calls
+  #endif
+#endif
+
+#if defined(EASYWIFI_NO_TRACE) && defined(EASYWIFI_TRACE_ROUTE)
+  #error "EASYWIFI_TRACE_ROUTE needs the trace, remove EASYWIFI_NO_TRACE"
+#endif
+
+namespace EASYWIFI{
+
+//Features compiled in, on unless their EASYWIFI_NO_ flag is set. The trace is left out by its own header
+struct BuildConfig
+{
+#ifdef EASYWIFI_NO_ROAMING
+  static constexpr bool hasRoaming = false;
+#else
+  static constexpr bool hasRoaming = true; //set_Roaming() is ignored without it
+#endif
+#ifdef EASYWIFI_NO_EVENTS
+  static constexpr bool hasEvents = false;
+#else
+  static constexpr bool hasEvents = true; //Server-Sent Events on /events, the page polls without them
+#endif
+#ifdef EASYWIFI_NO_LEGACY_NVS
+  static constexpr bool hasLegacyNvs = false;
+#else
+  static constexpr bool hasLegacyNvs = true; //Migrates networks stored by older versions
+#endif
+};
+
+//Indexes are returned as int8_t, -1 meaning not found
+static_assert(SCAN_MAX_ENTRIES > 0 && SCAN_MAX_ENTRIES <= 127, "SCAN_MAX_ENTRIES must be 1 to 127");
+static_assert(CREDENTIALS_MAX > 0 && CREDENTIALS_MAX <= 127, "CREDENTIALS_MAX must be 1 to 127");
+
+};
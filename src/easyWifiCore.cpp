@@ -5,108 +5,773 @@
 using namespace EASYWIFI;
 
 //Singleton
+#ifndef EASYWIFI_NO_SINGLETON
 EasyWifi easyWifi;
+#endif
 
 void EasyWifi::setup(const char* ssid, const char* passwd, unsigned long timeout)
 {
-  if(ssid!=nullptr)   _CaptivePortalSSID = ssid;
-  if(passwd!=nullptr) _CaptivePortalPassword = passwd;
+  StateLock lock(_stateMutex);
+  if(ssid!=nullptr)   strncpy(_CaptivePortalSSID, ssid, SSID_MAX_LENGTH); //Last byte is never written, stays '\0'
+  if(passwd!=nullptr) strncpy(_CaptivePortalPassword, passwd, PASSWORD_MAX_LENGTH);
   if(timeout!=0)      _CaptivePortalTimeout = timeout;
+  BootTimeline::mark(_metrics.boot.setup);
+  _trace.record(TRACE_EVENT::BOOT);
   
-  if(NVS_RetrieveWifiData())
-    connectWifi();
-  else 
+  if(!_reconnect.isSeeded())
+    _reconnect.seed(esp_random()); //Different on every device, so their retries spread apart
+
+  bool hasNetworks = NVS_RetrieveWifiData();
+  BootTimeline::mark(_metrics.boot.nvsRead);
+
+  if(!_isEventRegistered) //Runs on the WiFi event task, after the driver updated WiFi.status()
+  {
+    WiFi.onEvent([this](arduino_event_id_t, arduino_event_info_t info)
+    {
+      if(info.wifi_sta_disconnected.reason != WIFI_REASON_ASSOC_LEAVE) //Left on our own disconnect(), not a failure
+        _failedAttempt.store(_connectAttempt.load());
+    }, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+    _isEventRegistered = true;
+  }
+
+  //Portal is reachable before any radio work starts, scan and connection follow in background
+  if(!hasNetworks || _isPortalFirst)
     startCaptivePortal();
+
+  if(hasNetworks)
+    connectStoredNetworks();
+
+#ifdef EASYWIFI_TASK
+  if(_taskHandle == nullptr && xTaskCreatePinnedToCore(taskLoop, "easyWifi", EASYWIFI_TASK_STACK, this,
+      EASYWIFI_TASK_PRIORITY, &_taskHandle, EASYWIFI_TASK_CORE) != pdPASS)
+  {
+    ESP_LOGE(APP,"Failed to create the easyWifi task, call update() from loop()");
+    _taskHandle = nullptr;
+  }
+#endif
+}
+
+#ifdef EASYWIFI_TASK
+//Portal keeps its pace no matter what loop() does
+void EasyWifi::taskLoop(void *easyWifi)
+{
+  EasyWifi *self = static_cast<EasyWifi*>(easyWifi);
+  for(;;)
+  {
+    self->update();
+    vTaskDelay(pdMS_TO_TICKS(EASYWIFI_TASK_PERIOD));
+  }
 }
+#endif
+
+/// @brief Tries every stored network, best one first. Started at boot and by the reconnect scheduler
+void EasyWifi::connectStoredNetworks()
+{
+  StateLock lock(_stateMutex);
+  _reconnect.cancel();
+  _roundFailure = CONNECT_FAILURE::NOT_FOUND;
+  _isPortalAttempt = false;
 
-/// @brief Check all events, including the state machine 
+  if(_credentials.count() == 1) //Nothing to choose from, skip the scan
+  {
+    _candidates[0] = 0;
+    _candidateCount = 1;
+    _nextCandidate = 0;
+    connectNextCandidate();
+    return;
+  }
+
+  _isMatchPending = true; //Pick the best stored network once the scan finishes
+
+  if(_isCaptivePortalEnabled) //One full scan serves both the portal list and the match
+    scanNetworks(SCAN_PROFILE::FULL);
+  else
+    scanNetworks(SCAN_PROFILE::STORED_SSIDS); //Only stored SSIDs, on their last channel when known
+}
+
+/// @brief Check all events, including the state machine. Every step is non-blocking
 void EasyWifi::update()
 { 
+#ifdef EASYWIFI_TASK
+  if(_taskHandle != nullptr && xTaskGetCurrentTaskHandle() != _taskHandle) //Calls left in loop() are harmless
+    return;
+#endif
+  StateLock lock(_stateMutex); //Public methods called from loop() wait for this pass to end
+
+  //Connection and scan also run without portal, e.g. started in setup()
+  if(_wifiStatus == WIFI_STATUS::CONNECTING) 
+    checkConnection();
+
+  if(_scanStatus == SCAN_STATUS::READY_TO_SCAN && _wifiStatus != WIFI_STATUS::CONNECTING) //Radio can't scan and join at once
+    scanNetworks();
+
+  if(_scanStatus == SCAN_STATUS::RUNNING)
+    checkScanResult();
+
+  if(_isMatchPending && _scanStatus != SCAN_STATUS::RUNNING)
+    matchStoredNetworks();
+
+  //Paused while a portal opened for the user is up, they are about to give us a network. Portal-first keeps retrying behind it
+  if((!_isCaptivePortalEnabled || _isPortalFirst) && _scanStatus != SCAN_STATUS::RUNNING && _reconnect.isDue(millis()))
+    connectStoredNetworks();
+
+  if(BuildConfig::hasRoaming && _isRoamScanPending && _scanStatus != SCAN_STATUS::RUNNING)
+    finishRoamingScan();
+
+  //Only on a settled link, a running scan or connection is never interrupted
+  if(BuildConfig::hasRoaming && _isRoamingEnabled && !_isCaptivePortalEnabled && _wifiStatus == WIFI_STATUS::CONNECTED && _scanStatus != SCAN_STATUS::RUNNING && !_isRoamScanPending)
+    checkRoaming();
+
   if(!_isCaptivePortalEnabled)
     return;
 
+  uint32_t freeHeap = ESP.getFreeHeap();
+  if(freeHeap < _metrics.minFreeHeap || _metrics.minFreeHeap == 0)
+    _metrics.minFreeHeap = freeHeap;
+
   checkCaptivePortalTimeout();
 
   
-  if(_dnsServer) 
+  if(_dnsServer) //No-op with EASYWIFI_ASYNC_DNS, queries are answered as they arrive
   _dnsServer->processNextRequest(); 
+
+  processCommands();
   
   if(_wifiStatus == WIFI_STATUS::CONNECTED)
-    logoutCaptivePortal();
+  {
+    if(!_isLogoutPending) //Give the user some time to see the connected message
+    {
+      _isLogoutPending = true;
+      _logoutRequestTime = millis();
+    }
+    else if(millis() - _logoutRequestTime >= PORTAL_LOGOUT_DELAY)
+    {
+      logoutCaptivePortal();
+      return;
+    }
+  }
     
   if(_wifiStatus == WIFI_STATUS::READY_TO_CONNECT)
+  {
+    _candidateCount = 0; //Network typed on portal, don't fall back to stored ones
+    _activeChannel = 0; //No known AP for it, full scan
     connectWifi();
+  }
 
-  if(_scanStatus == SCAN_STATUS::READY_TO_SCAN)
-    scanNetworks();
+  pushStatusEvents();
+}
+
+void EasyWifi::processCommands()
+{
+  PORTAL_COMMAND command;
+  while(_commands.pop(command))
+  {
+    _trace.record(TRACE_EVENT::COMMAND, (uint8_t)command);
+    switch(command)
+    {
+      case PORTAL_COMMAND::START_SCAN: //Fresh cached results or a scan already on the way are reused instead of restarting the radio
+        if(!isScanCacheValid(publishedScan()) && _scanStatus != SCAN_STATUS::RUNNING)
+          setScanStatus(SCAN_STATUS::READY_TO_SCAN);
+      break;
+
+      case PORTAL_COMMAND::CONNECT:
+        if(_wifiStatus == WIFI_STATUS::CONNECTING) //Stored network tried in background, the handler lets the user's one replace it
+          WiFi.disconnect();
+        _isMatchPending = false; //Nor does a background round start or go on afterwards
+        _reconnect.cancel();
+        _isPortalAttempt = true;
+        strcpy(_ssidStored, _stagedSsid);
+        strcpy(_passwdStored, _stagedPasswd);
+        _isProtected = _stagedIsProtected;
+        _connectSession = _stagedSession;
+        setWifiStatus(WIFI_STATUS::READY_TO_CONNECT); //Set before releasing, so /wifi-status never sees a gap
+        _isStagingBusy = false;
+      break;
+
+      case PORTAL_COMMAND::CLEAR_ERROR:
+        if(_wifiStatus == WIFI_STATUS::ERROR)
+          setWifiStatus(WIFI_STATUS::IDLE);
+      break;
+    }
+  }
 }
 
-/// @return True if connection was successful, false if Failed
+/// @brief Starts the connection, the result is reported by checkConnection() through update()
+/// @return True if the attempt was started, false if the driver refused it
 bool EasyWifi::connectWifi()
 {
-  ESP_LOGV(APP, "Trying Connection to %s with password: %s", _ssidStored, _passwdStored);
+  StateLock lock(_stateMutex);
+  _connectRequestTime = millis();
+  return beginConnection();
+}
+
+/// @brief If the last AP used by this network is known, joins it directly without scanning every channel
+bool EasyWifi::beginConnection()
+{
+  ESP_LOGV(APP, "Trying Connection to %s", _ssidStored); //Password is never logged
 
-  _wifiStatus = WIFI_STATUS::CONNECTING;
   WiFi.setAutoReconnect(false); // avoid reconnecting to network if WiFi conn fails, will be re-enabled after connection
 
-  if(_isProtected)
-    WiFi.begin(_ssidStored,_passwdStored);
+  _isFastConnect = _activeChannel != 0;
+  _trace.record(TRACE_EVENT::CONNECT_START, _isFastConnect, _activeChannel, hashString(_ssidStored));
+  const char *passwd = _isProtected ? _passwdStored : nullptr;
+
+  wl_status_t previousStatus = WiFi.status();
+  wl_status_t beginStatus;
+  _connectAttempt++; //Failure states left by the previous attempt are ignored from here on
+  if(_isFastConnect)
+    beginStatus = WiFi.begin(_ssidStored, passwd, _activeChannel, _activeBssid);
   else
-    WiFi.begin(_ssidStored);
+    beginStatus = WiFi.begin(_ssidStored, passwd);
+
+  _connectStartTime = millis();
+  setWifiStatus(WIFI_STATUS::CONNECTING);
+
+  //begin() returns status(), a failure it didn't cause itself is the last attempt's and the timeout covers a refusal
+  if(beginStatus == WL_CONNECT_FAILED && previousStatus != WL_CONNECT_FAILED) //Report the failure right away
+  {
+    finishConnection(false);
+    return false;
+  }
+  return true;
+}
+
+void EasyWifi::checkConnection()
+{
+  wl_status_t status = WiFi.status();
 
-  //While loop inside waitForConnectResult, with a timeout parameter
-  if(WiFi.waitForConnectResult(8000) != WL_CONNECTED)
+  if(status == WL_CONNECTED)
   {
-    _wifiStatus = WIFI_STATUS::ERROR;  
+    finishConnection(true);
+    return;
+  }
+
+  //Same final states waitForConnectResult() stops on, anything else is still in progress.
+  //begin() doesn't reset them, so they only count once this attempt got a disconnect event
+  bool hasFailed = (status == WL_CONNECT_FAILED || status == WL_NO_SSID_AVAIL) &&
+                   _failedAttempt.load() == _connectAttempt.load();
+  unsigned long timeout = _isFastConnect ? FAST_CONNECT_TIMEOUT : _connectTimeout;
+  if(!hasFailed && millis() - _connectStartTime < timeout)
+    return;
+
+  if(hasFailed && status == WL_CONNECT_FAILED) //Driver reports rejected handshakes this way, one in the round is enough to blame the password
+    _roundFailure = CONNECT_FAILURE::AUTH_FAILED;
+  finishConnection(false);
+}
+
+void EasyWifi::finishConnection(bool isConnected)
+{
+  if(isConnected)
+  {
+    _connectDuration = millis() - _connectRequestTime;
+    _metrics.connect.record(_connectDuration * 1000);
+    _trace.record(TRACE_EVENT::CONNECT_DONE, 0, 0, _connectDuration);
+    ESP_LOGI(APP,"Connected to: %s in %lu ms%s\n", _ssidStored, _connectDuration, _isFastConnect ? " (fast reconnect)" : "");
+
+    setWifiStatus(WIFI_STATUS::CONNECTED);
+    _reconnect.reset();
+    _roaming.restart(); //New AP, its signal is sampled from scratch
+    if(_isRoamAttempt)
+      _metrics.roams++;
+    _isRoamAttempt = false;
+    if(BootTimeline::mark(_metrics.boot.connected)) //Reconnects and roams later on are not part of the boot
+      ESP_LOGI(APP,"Boot: portal up at %" PRIu32 " ms, connected at %" PRIu32 " ms", _metrics.boot.portalUp, _metrics.boot.connected);
+    NVS_SaveWifiSettings();  
+    WiFi.setAutoReconnect(true); //Re-enable auto reconnect by default
+  }
+  else
+  {
+    _trace.record(TRACE_EVENT::CONNECT_FAILED, WiFi.status(), 0, hashString(_ssidStored));
+    WiFi.disconnect(); //Stop the driver from trying in background
+    _metrics.failedConnects++;
+
+    if(_isRoamAttempt) //Fallback below joins whichever AP of the network answers
+      _metrics.failedRoams++;
+    _isRoamAttempt = false;
+
+    if(_isFastConnect) //AP moved or changed channel, same network again with a full scan
+    {
+      ESP_LOGI(APP,"Fast reconnect failed, scanning all channels");
+      _activeChannel = 0;
+      beginConnection();
+      return;
+    }
+
+    if(connectNextCandidate()) //Other stored networks are in range, try them before giving up
+      return;
+
+    setWifiStatus(WIFI_STATUS::ERROR);  
     ESP_LOGE(APP,"Failed to connect to Wifi:%s\n",_ssidStored);
+  }
 
+  if(_onConnectionResult) 
+    _onConnectionResult(_wifiStatus);
+
+  if(!isConnected)
+    scheduleReconnect();
+}
+
+/// @brief Every stored network failed, either retries them later or opens the portal, depending on the policy
+void EasyWifi::scheduleReconnect()
+{
+  //Portal opened for the user: its own attempts and stored networks both wait for what they type, errors are shown there.
+  //Portal-first keeps the backoff going, also after a failed network typed on it
+  if(_isCaptivePortalEnabled && !_isPortalFirst)
+    return;
+
+  uint8_t portalAfter = _portalAfterFailures[(uint8_t)_roundFailure];
+  if(!_isCaptivePortalEnabled && portalAfter != 0 && _reconnect.get_failures() + 1 >= portalAfter)
+  {
+    ESP_LOGI(APP,"%d failed reconnect rounds, opening the portal", _reconnect.get_failures() + 1);
+    _trace.record(TRACE_EVENT::RECONNECT, _reconnect.get_failures() + 1, (uint16_t)_roundFailure, 0);
+    _reconnect.reset();
     startCaptivePortal();
+    return;
+  }
+
+  uint32_t retryDelay = _reconnect.schedule(millis());
+  _trace.record(TRACE_EVENT::RECONNECT, _reconnect.get_failures(), (uint16_t)_roundFailure, retryDelay);
+  ESP_LOGI(APP,"%d failed reconnect rounds, retrying stored networks later", _reconnect.get_failures());
+}
+
+void EasyWifi::set_ReconnectPolicy(CONNECT_FAILURE failure, uint8_t portalAfter)
+{
+  StateLock lock(_stateMutex);
+  _portalAfterFailures[(uint8_t)failure] = portalAfter;
+}
+
+//Non-blocking, only asks the driver to start scanning, update() polls the result
+void EasyWifi::scanNetworks(SCAN_PROFILE profile)
+{
+  StateLock lock(_stateMutex);
+  uint8_t steps = profile == SCAN_PROFILE::CHANNELS ? _scanChannelCount : 1;
+
+  if(profile == SCAN_PROFILE::STORED_SSIDS)
+  {
+    //A directed probe without a channel sweeps them all, so networks never connected before share one full pass.
+    //It runs only if the probes find nothing, a stored network in range is joined without waiting for it
+    bool hasUnknownChannel = false;
+    _scanTargetCount = 0;
+    for(uint8_t i = 0; i < _credentials.count(); i++)
+    {
+      if(_credentials.get(i).channel != 0)
+        _scanTargets[_scanTargetCount++] = i;
+      else
+        hasUnknownChannel = true;
+    }
+    steps = _scanTargetCount + (hasUnknownChannel ? 1 : 0);
+  }
+
+  if(steps == 0) //Nothing to target, every channel is scanned instead
+  {
+    profile = SCAN_PROFILE::FULL;
+    steps = 1;
+  }
+
+  ESP_LOGV(APP, "Starting async network scan, %s profile in %d steps", toString(profile), steps);
+
+  //Results go to a back buffer, clients keep reading the last scan until this one finishes
+  _pendingScanTable.clear();
+
+  _scanProfile = profile;
+  _scanStep = 0;
+  _scanStepCount = steps;
+  _scanStartMicros = micros();
+  _trace.record(TRACE_EVENT::SCAN_START, (uint8_t)profile, steps);
+
+  if(!startScanStep())
+  {
+    ESP_LOGE(APP,"Failed to start network scan");
+    _trace.record(TRACE_EVENT::SCAN_FAILED, 0);
+    setScanStatus(SCAN_STATUS::NOT_RUNNING);
+    return;
+  }
+
+  setScanStatus(SCAN_STATUS::RUNNING);
+}
+
+/// @brief Starts the driver scan for _scanStep, each step is one channel or one SSID of the profile
+bool EasyWifi::startScanStep()
+{
+  const char *ssid = nullptr;
+  uint8_t channel = 0; //0 scans every channel
+  bool isPassive = _isPassiveScan;
+  uint16_t dwell = _scanDwell;
+
+  switch(_scanProfile)
+  {
+    case SCAN_PROFILE::STORED_SSIDS:
+      if(_scanStep >= _scanTargetCount) //Last step, full pass for the networks without a known channel
+        break;
+      if(_scanTargets[_scanStep] >= _credentials.count()) //Store changed during the scan
+        return false;
+      //Directed probe on the channel of the last connection, only APs of this SSID answer
+      ssid = _credentials.get(_scanTargets[_scanStep]).ssid;
+      channel = _credentials.get(_scanTargets[_scanStep]).channel;
+      isPassive = false;
+      dwell = SCAN_TARGETED_DWELL;
+      break;
+
+    case SCAN_PROFILE::CHANNELS:
+      channel = _scanChannels[_scanStep].channel;
+      isPassive = _scanChannels[_scanStep].isPassive;
+      dwell = _scanChannels[_scanStep].dwell;
+      break;
+
+    case SCAN_PROFILE::CONNECTED_SSID: //Every channel, other APs of the network may be anywhere
+      ssid = _ssidStored;
+      isPassive = false;
+      dwell = SCAN_TARGETED_DWELL;
+      break;
+
+    case SCAN_PROFILE::FULL:
+      break;
+  }
+
+  _scanStartTime = millis(); //SCAN_TIMEOUT applies to every step
+  _trace.record(TRACE_EVENT::SCAN_STEP, _scanStep, channel);
+  return WiFi.scanNetworks(true, false, isPassive, dwell, channel, ssid) != WIFI_SCAN_FAILED;
+}
+
+void EasyWifi::checkScanResult()
+{
+  if(_isPublishPending) //Radio is done, only waiting for the slot
+  {
+    finishScan();
+    return;
+  }
+
+  int16_t result = WiFi.scanComplete();
+
+  if(result == WIFI_SCAN_RUNNING)
+  {
+    if(millis() - _scanStartTime >= SCAN_TIMEOUT)
+    {
+      ESP_LOGE(APP,"Network scan timed out");
+      _trace.record(TRACE_EVENT::SCAN_FAILED, 2);
+      WiFi.scanDelete();
+      setScanStatus(SCAN_STATUS::NOT_RUNNING);
+    }
+    return;
+  }
+
+  if(result == WIFI_SCAN_FAILED)
+  {
+    ESP_LOGE(APP,"Network scan failed"); //Last results are kept, the status already tells they're not valid
+    _trace.record(TRACE_EVENT::SCAN_FAILED, 1);
+    setScanStatus(SCAN_STATUS::NOT_RUNNING);
+    return;
+  }
+
+  //Every step is merged into the table, so the driver buffer can be freed now instead of at the next scan
+  for(int16_t i = 0; i < result; i++)
+  {
+    const wifi_ap_record_t *record = static_cast<const wifi_ap_record_t*>(WiFi.getScanInfoByIndex(i));
+    if(record)
+      _pendingScanTable.add(reinterpret_cast<const char*>(record->ssid), record->rssi, record->bssid, record->primary, record->authmode != WIFI_AUTH_OPEN);
+  }
+  WiFi.scanDelete();
+
+  //Probes only see their own SSID, anything found is a stored network to connect to
+  if(++_scanStep == _scanTargetCount && _scanProfile == SCAN_PROFILE::STORED_SSIDS && _pendingScanTable.count() > 0)
+    _scanStepCount = _scanStep;
+
+  if(_scanStep < _scanStepCount)
+  {
+    if(startScanStep())
+      return;
+
+    ESP_LOGE(APP,"Failed to start scan step %d, keeping the results so far", _scanStep);
+  }
+
+  _pendingScanTable.sort();
+  finishScan();
+}
+
+/// @brief Publishes the finished scan, or waits for the next update() pass if a response still sends the slot it needs
+void EasyWifi::finishScan()
+{
+  _isPublishPending = !publishScanResults(); //Swapped in only now, clients kept reading the last results meanwhile
+  if(_isPublishPending)
+    return;
+
+  const ScanSnapshot &scan = publishedScan();
+  ESP_LOGV(APP,"Scan found %d distinct networks",scan.table.count());
+  BootTimeline::mark(_metrics.boot.firstScan);
+  _metrics.scan.record(micros() - _scanStartMicros);
+  _trace.record(TRACE_EVENT::SCAN_DONE, scan.table.count(), 0, scan.generation);
+  setScanStatus(SCAN_STATUS::FINISHED);
+}
+
+//Counts one more user of slot, unless update() is writing it
+static bool holdSlot(ScanSlot &slot)
+{
+  uint8_t users = slot.users.load();
+  do
+  {
+    if(users == SCAN_SLOT_WRITING)
+      return false;
+  } while(!slot.users.compare_exchange_weak(users, users + 1));
+  return true;
+}
+
+/// @brief Writes the pending table into the slot that is not published, then publishes it. The old one stays as the delta base
+/// @return False if a response still holds that slot, nothing was changed
+bool EasyWifi::publishScanResults()
+{
+  uint8_t published = _publishedSlot.load();
+  uint8_t next = 1 - published;
+  uint8_t idle = 0;
+  if(!_scanSlots[next].users.compare_exchange_strong(idle, SCAN_SLOT_WRITING))
+    return false;
+
+  ScanSnapshot &scan = _scanSlots[next].snapshot;
+  scan.table = _pendingScanTable;
+  scan.generation = _scanSlots[published].snapshot.generation + 1;
+  scan.hash = scan.table.contentHash();
+  scan.profile = _scanProfile;
+  scan.finishedTime = millis();
+
+  _scanSlots[next].users.store(0);
+  _publishedSlot.store(next);
+  return true;
+}
+
+ScanSnapshotRef EasyWifi::readScanResults()
+{
+  for(;;)
+  {
+    uint8_t index = _publishedSlot.load();
+    if(holdSlot(_scanSlots[index]))
+    {
+      if(_publishedSlot.load() == index)
+        return ScanSnapshotRef(&_scanSlots[index]);
+      _scanSlots[index].users--; //Published again meanwhile, take the newer one
+    }
+    //A slot being written is never the published one, the next load finds the new index
+  }
+}
+
+ScanSnapshotRef EasyWifi::readPreviousScan(uint32_t generation)
+{
+  ScanSlot &slot = _scanSlots[1 - _publishedSlot.load()];
+  if(!holdSlot(slot))
+    return ScanSnapshotRef();
+
+  ScanSnapshotRef previous(&slot);
+  if(previous->generation != generation || generation == 0)
+    return ScanSnapshotRef();
+  return previous;
+}
+
+/// @brief Samples the link once per ROAMING_SAMPLE_INTERVAL, a weak average starts a directed scan of the network in use
+void EasyWifi::checkRoaming()
+{
+  unsigned long now = millis();
+  if(now - _roamSampleTime < ROAMING_SAMPLE_INTERVAL)
+    return;
+  _roamSampleTime = now;
+
+  if(!WiFi.isConnected()) //Link lost, the driver auto reconnect takes care of it
+    return;
+
+  _roaming.sample(WiFi.RSSI());
+  _metrics.rssiAverage = _roaming.get_averageRssi();
+  if(_metrics.rssiAverage < _metrics.rssiMin || _metrics.rssiMin == 0)
+    _metrics.rssiMin = _metrics.rssiAverage;
+
+  if(!_roaming.isScanDue(now))
+    return;
+
+  ESP_LOGI(APP,"Signal at %d dBm, looking for a better AP", _metrics.rssiAverage);
+  _trace.record(TRACE_EVENT::ROAM_SCAN, (uint8_t)_metrics.rssiAverage);
+  _roaming.scanStarted(now);
+  _metrics.roamScans++;
+  _isRoamScanPending = true;
+  scanNetworks(SCAN_PROFILE::CONNECTED_SSID);
+}
+
+void EasyWifi::finishRoamingScan()
+{
+  _isRoamScanPending = false;
+  if(_scanStatus != SCAN_STATUS::FINISHED || _wifiStatus != WIFI_STATUS::CONNECTED)
+    return;
+
+  const ScanTable &table = publishedScan().table;
+  int8_t index = table.find(_ssidStored);
+  if(index < 0)
+    return;
+
+  const ScanEntry &best = table.get(index); //Table keeps only the strongest AP of each SSID
+  const uint8_t *current = WiFi.BSSID();
+  bool isSameAp = current != nullptr && memcmp(best.bssid, current, sizeof(best.bssid)) == 0;
+  if(isSameAp || !_roaming.isBetter(best.rssi))
+    return;
+
+  ESP_LOGI(APP,"Roaming from %d dBm to an AP at %d dBm on channel %d", _roaming.get_averageRssi(), best.rssi, best.channel);
+  _trace.record(TRACE_EVENT::ROAM, (uint8_t)_roaming.get_averageRssi(), best.channel, (uint8_t)best.rssi);
+
+  //Joined like a fast reconnect, a failed move falls back to a full scan of the same network
+  memcpy(_activeBssid, best.bssid, sizeof(_activeBssid));
+  _activeChannel = best.channel;
+  _candidateCount = 0;
+  _isRoamAttempt = true;
+  _roaming.scanStarted(millis()); //Holds the next scan back for a whole interval
+  connectWifi();
+}
+
+bool EasyWifi::set_ScanChannels(const ScanChannel *channels, uint8_t count)
+{
+  StateLock lock(_stateMutex);
+  if(count > SCAN_CHANNELS_MAX)
     return false;
+
+  memcpy(_scanChannels, channels, count * sizeof(ScanChannel));
+  _scanChannelCount = count;
+  return true;
+}
+
+void EasyWifi::matchStoredNetworks()
+{
+  _isMatchPending = false;
+  bool hasResults = _scanStatus == SCAN_STATUS::FINISHED;
+
+  //One pass over scan results, each SSID is a hash lookup on the store
+  const ScanTable &table = publishedScan().table;
+  _credentials.beginMatch();
+  for(uint8_t i = 0; hasResults && i < table.count(); i++)
+    _credentials.offer(table.get(i).ssid, table.get(i).rssi);
+
+  //If scan failed we can't tell what is in range, so every stored network is tried
+  _candidateCount = _credentials.rank(_candidates, !hasResults);
+  _nextCandidate = 0;
+
+  ESP_LOGI(APP,"%d stored networks to try",_candidateCount);
+
+  if(_candidateCount == 0 && hasResults && _scanProfile != SCAN_PROFILE::FULL) //Narrow scan missed them, maybe on another channel
+  {
+    _isMatchPending = true;
+    scanNetworks(SCAN_PROFILE::FULL);
+    return;
   }
 
-  ESP_LOGI(APP,"Connected to: %s\n", _ssidStored);
+  if(!connectNextCandidate())
+    scheduleReconnect(); //None in range
+}
+
+/// @return True if a connection to the next ranked stored network was started
+bool EasyWifi::connectNextCandidate()
+{
+  if(_nextCandidate >= _candidateCount)
+    return false;
 
-  _wifiStatus = WIFI_STATUS::CONNECTED;
-  NVS_SaveWifiSettings();  
-  WiFi.setAutoReconnect(true); //Re-enable auto reconnect by default
+  const WifiCredential &credential = _credentials.get(_candidates[_nextCandidate++]);
+  strcpy(_ssidStored, credential.ssid);
+  strcpy(_passwdStored, credential.passwd);
+  _isProtected = credential.isProtected;
+  memcpy(_activeBssid, credential.bssid, sizeof(_activeBssid));
+  _activeChannel = credential.channel;
+
+  connectWifi();
   return true;
 }
 
-//Blocking function, it haves state machine to avoid blocking the server
-void EasyWifi::scanNetworks()
+bool EasyWifi::addCredential(const char* ssid, const char* passwd, uint8_t priority)
+{
+  StateLock lock(_stateMutex);
+  bool isProtected = passwd != nullptr && passwd[0] != '\0';
+  if(_credentials.add(ssid, passwd, isProtected, priority) < 0)
+    return false;
+
+  return NVS_SaveCredentials();
+}
+
+bool EasyWifi::removeCredential(const char* ssid)
 {
-  ESP_LOGV(APP, "Scanning Networks");
+  StateLock lock(_stateMutex);
+  if(!_credentials.remove(ssid))
+    return false;
 
-  _scanStatus = SCAN_STATUS::RUNNING;
-  _avaibleNetworks = WiFi.scanNetworks();
+  return NVS_SaveCredentials();
+}
 
-  ESP_LOGV(APP,"Scan found %d networks",_avaibleNetworks);
-  _scanStatus = SCAN_STATUS::FINISHED;
+/// @param scan publishedScan() from update(), held with readScanResults() anywhere else
+/// @return True if the last finished scan is younger than the cache TTL
+bool EasyWifi::isScanCacheValid(const ScanSnapshot &scan)
+{
+  //Narrow profiles miss networks the portal should list
+  return _scanStatus == SCAN_STATUS::FINISHED && scan.profile == SCAN_PROFILE::FULL && millis() - scan.finishedTime < _scanCacheTTL;
 }
 
 bool EasyWifi::NVS_RetrieveWifiData()
 { 
   ESP_LOGV(APP, "Retrieving WiFi data from NVS");
+  PhaseTimer timer(_metrics.nvsRead);
 
   _wifiDataNVS.begin(NVS_NAMESPACE,NVS_READ_ONLY);
-  
+
+  if(_wifiDataNVS.isKey(NVS_KEY_RECORD))
+  {
+    uint8_t record[CREDENTIAL_RECORD_MAX_SIZE];
+    size_t size = _wifiDataNVS.getBytes(NVS_KEY_RECORD, record, sizeof(record));
+    _wifiDataNVS.end();
+
+    if(!_credentials.unpack(record, size))
+    {
+      ESP_LOGE(APP,"Error: stored networks are corrupted or from another version.");
+      return false;
+    }
+
+    //Flash holds exactly this now, saving the same networks again is skipped
+    memcpy(_nvsShadow, record, size);
+    _nvsShadowSize = size;
+    _isNvsShadowValid = true;
+
+    ESP_LOGI(APP,"%d stored networks found",_credentials.count());
+    _trace.record(TRACE_EVENT::NVS_READ, _credentials.count());
+    return _credentials.count() > 0;
+  }
+
+  if(!BuildConfig::hasLegacyNvs) //Older formats are not looked for, nothing stored
+  {
+    _wifiDataNVS.end();
+    ESP_LOGI(APP,"No stored networks found");
+    _isNvsShadowValid = true;
+    return false;
+  }
+
+  bool isMigrated = NVS_RetrieveLegacyData();
+  _wifiDataNVS.end();
+
+  _trace.record(TRACE_EVENT::NVS_READ, _credentials.count());
+  if(!isMigrated)
+    return false;
+
+  //Rewritten once as a record, old keys are removed only after it is safely stored
+  if(NVS_SaveCredentials())
+    NVS_RemoveLegacyKeys();
+  return true;
+}
+
+/// @brief Older versions stored a single network in separated keys. NVS must be open
+bool EasyWifi::NVS_RetrieveLegacyData()
+{
   if(!(_wifiDataNVS.isKey(NVS_KEY_SSID))) 
   {
     ESP_LOGI(APP,"No SSID found on NVS memory");
-    _wifiDataNVS.end();
+    _isNvsShadowValid = true; //Nothing stored, matches the empty shadow
     return false;
   }
 
   //Retrieve Data 
-  size_t ssidLength = _wifiDataNVS.getString(NVS_KEY_SSID, _ssidStored, SSID_MAX_LENGTH);
-  size_t passwdLength = _wifiDataNVS.getString(NVS_KEY_PASSWD, _passwdStored, PASSWORD_MAX_LENGTH);
+  size_t ssidLength = _wifiDataNVS.getString(NVS_KEY_SSID, _ssidStored, sizeof(_ssidStored));
+  size_t passwdLength = _wifiDataNVS.getString(NVS_KEY_PASSWD, _passwdStored, sizeof(_passwdStored));
   _isProtected = _wifiDataNVS.getBool(NVS_KEY_ISPROTECTED);
 
   //Check if SSID Exists
   if(ssidLength <= 0)
   {
     ESP_LOGE(APP,"Error: SSID retrieval failed or empty.");
-    _wifiDataNVS.end();
     return false;
   }
 
@@ -114,17 +779,29 @@ bool EasyWifi::NVS_RetrieveWifiData()
   if(_isProtected && passwdLength <= 0)
   {
     ESP_LOGE(APP,"Error: Password retrieval failed or empty for encrypted network.");
-    _wifiDataNVS.end();
     return false;
   }
   
-  _wifiDataNVS.end();
-  ESP_LOGI(APP,"SSID Found: %s",_ssidStored);
+  _credentials.add(_ssidStored, _passwdStored, _isProtected);
+  ESP_LOGI(APP,"SSID Found: %s, migrating",_ssidStored);
   return true;
 }
 
+void EasyWifi::NVS_RemoveLegacyKeys()
+{
+  _wifiDataNVS.begin(NVS_NAMESPACE,NVS_READ_WRITE);
+
+  const char *keys[] = { NVS_KEY_SSID, NVS_KEY_PASSWD, NVS_KEY_ISPROTECTED };
+  for(const char *key : keys)
+    if(_wifiDataNVS.isKey(key))
+      _wifiDataNVS.remove(key);
+
+  _wifiDataNVS.end();
+}
+
 bool EasyWifi::NVS_Clear() 
 {
+  StateLock lock(_stateMutex);
   ESP_LOGI(APP, "Clearing NVS Memory");
   _wifiDataNVS.begin(NVS_NAMESPACE, NVS_READ_WRITE);
 
@@ -137,35 +814,71 @@ bool EasyWifi::NVS_Clear()
 
   ESP_LOGI(APP,"NVS Cleared");
   _wifiDataNVS.end();
+  _credentials.clear();
+  _nvsShadowSize = 0;
+  _isNvsShadowValid = true;
   return true; 
 }
 
+/// @brief Stores the network in use as the last successful one
 bool EasyWifi::NVS_SaveWifiSettings()
 {
-  ESP_LOGI(APP, "Saving WiFi data on NVS");
-  _wifiDataNVS.begin(NVS_NAMESPACE,NVS_READ_WRITE);
+  StateLock lock(_stateMutex);
+  int8_t index = _credentials.find(_ssidStored);
+  uint8_t priority = index >= 0 ? _credentials.get(index).priority : 0; //Keep user priority on update
 
-  _wifiDataNVS.clear();
+  index = _credentials.add(_ssidStored, _passwdStored, _isProtected, priority);
+  if(index < 0)
+  {
+    ESP_LOGE(APP,"Invalid SSID, not saved on NVS");
+    return false;
+  }
 
-  //NVS returns 0 if error occurs
-  bool ssidCheck = _wifiDataNVS.putString(NVS_KEY_SSID, _ssidStored) != 0;
-  bool isProtectedCheck = _wifiDataNVS.putBool(NVS_KEY_ISPROTECTED, _isProtected);
-  bool passwordCheck = true;
+  _credentials.markSuccess(index);
+  _credentials.setLastAccessPoint(index, WiFi.BSSID(), WiFi.channel()); //Used for fast reconnect on next boot
+  return NVS_SaveCredentials();
+}
+
+/// @brief Writes every stored network as a single record, skipped if flash already holds the same bytes
+bool EasyWifi::NVS_SaveCredentials()
+{
+  StateLock lock(_stateMutex);
+  uint8_t record[CREDENTIAL_RECORD_MAX_SIZE];
+  size_t size = _credentials.count() ? _credentials.pack(record) : 0; //Empty store removes the record
 
-  if(_isProtected && isProtectedCheck) //If network is protected and suceffuly saved on nvs
+  if(_isNvsShadowValid && size == _nvsShadowSize && memcmp(record, _nvsShadow, size) == 0)
   {
-    _wifiDataNVS.putString(NVS_KEY_PASSWD, _passwdStored);
-    passwordCheck = _wifiDataNVS.putString(NVS_KEY_PASSWD, _passwdStored) != 0;
+    ESP_LOGV(APP, "WiFi data unchanged, NVS write skipped");
+    _metrics.nvsWritesSkipped++;
+    _trace.record(TRACE_EVENT::NVS_WRITE_SKIPPED);
+    return true;
   }
 
-  if(!ssidCheck || !isProtectedCheck || !passwordCheck)
+  ESP_LOGI(APP, "Saving WiFi data on NVS");
+  PhaseTimer timer(_metrics.nvsWrite);
+  _wifiDataNVS.begin(NVS_NAMESPACE,NVS_READ_WRITE);
+
+  //NVS returns 0 if error occurs
+  bool isSaved;
+  if(size == 0)
+    isSaved = !_wifiDataNVS.isKey(NVS_KEY_RECORD) || _wifiDataNVS.remove(NVS_KEY_RECORD);
+  else
+    isSaved = _wifiDataNVS.putBytes(NVS_KEY_RECORD, record, size) == size;
+
+  _wifiDataNVS.end();
+  _trace.record(TRACE_EVENT::NVS_WRITE, _credentials.count(), size, isSaved);
+
+  if(!isSaved)
   {
     ESP_LOGE(APP,"Error saving data in NVS");
+    _isNvsShadowValid = false; //Flash content unknown, next save writes again
     return false;
   }
 
+  memcpy(_nvsShadow, record, size);
+  _nvsShadowSize = size;
+  _isNvsShadowValid = true;
 
-  ESP_LOGI(APP,"SSID: %s saved on NVS",_ssidStored);
-  _wifiDataNVS.end();
+  ESP_LOGI(APP,"%d networks saved on NVS",_credentials.count());
   return true;
 }
\ No newline at end of file
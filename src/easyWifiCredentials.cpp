@@ -0,0 +1,229 @@
+//easyWifiCredentials.cpp
+
+#include "easyWifiCredentials.h"
+
+using namespace EASYWIFI;
+
+int8_t CredentialStore::find(const char *ssid) const
+{
+  uint32_t hash = hashString(ssid);
+
+  //Linear probing, stops at the first empty slot
+  for(uint8_t probe = 0; probe < CREDENTIAL_INDEX_SIZE; probe++)
+  {
+    uint8_t slot = _index[(hash + probe) % CREDENTIAL_INDEX_SIZE];
+    if(slot == 0)
+      return -1;
+
+    uint8_t index = slot - 1;
+    if(_hashes[index] == hash && strcmp(_credentials[index].ssid, ssid) == 0)
+      return index;
+  }
+  return -1;
+}
+
+int8_t CredentialStore::add(const char *ssid, const char *passwd, bool isProtected, uint8_t priority)
+{
+  size_t ssidLength = strlen(ssid);
+  if(ssidLength == 0 || ssidLength > SSID_MAX_LENGTH)
+    return -1;
+
+  int8_t index = find(ssid);
+  bool isNew = index < 0;
+
+  if(isNew && _count < CREDENTIALS_MAX)
+    index = _count++;
+  else if(isNew) //Full, replace the network that would be tried last
+  {
+    index = 0;
+    for(uint8_t i = 1; i < _count; i++)
+      if(_credentials[i].priority < _credentials[index].priority ||
+        (_credentials[i].priority == _credentials[index].priority && _credentials[i].lastSuccess < _credentials[index].lastSuccess))
+        index = i;
+  }
+
+  WifiCredential &credential = _credentials[index];
+  if(isNew)
+  {
+    memset(&credential, 0, sizeof(credential));
+    strncpy(credential.ssid, ssid, SSID_MAX_LENGTH);
+  }
+
+  else if(strcmp(credential.passwd, passwd ? passwd : "") != 0)
+    credential.channel = 0; //Password changed, last AP is not a reliable shortcut anymore
+
+  strncpy(credential.passwd, passwd ? passwd : "", PASSWORD_MAX_LENGTH);
+  credential.passwd[PASSWORD_MAX_LENGTH] = '\0';
+  credential.isProtected = isProtected;
+  credential.priority = priority;
+
+  if(isNew)
+    rebuildIndex();
+  return index;
+}
+
+bool CredentialStore::remove(const char *ssid)
+{
+  int8_t index = find(ssid);
+  if(index < 0)
+    return false;
+
+  _count--;
+  memmove(&_credentials[index], &_credentials[index + 1], (_count - index) * sizeof(WifiCredential));
+  rebuildIndex();
+  return true;
+}
+
+void CredentialStore::clear()
+{
+  _count = 0;
+  rebuildIndex();
+}
+
+void CredentialStore::markSuccess(uint8_t index)
+{
+  uint32_t newest = 0;
+  for(uint8_t i = 0; i < _count; i++)
+    if(_credentials[i].lastSuccess > newest)
+      newest = _credentials[i].lastSuccess;
+
+  if(newest != 0 && _credentials[index].lastSuccess == newest) //Already the most recent, keep the record unchanged
+    return;
+
+  _credentials[index].lastSuccess = newest + 1;
+}
+
+void CredentialStore::setLastAccessPoint(uint8_t index, const uint8_t *bssid, uint8_t channel)
+{
+  WifiCredential &credential = _credentials[index];
+
+  if(bssid == nullptr)
+  {
+    credential.channel = 0;
+    return;
+  }
+
+  memcpy(credential.bssid, bssid, sizeof(credential.bssid));
+  credential.channel = channel;
+}
+
+size_t CredentialStore::pack(uint8_t *out) const
+{
+  CredentialRecordHeader header;
+  header.magic = CREDENTIAL_RECORD_MAGIC;
+  header.version = CREDENTIAL_RECORD_VERSION;
+  header.count = _count;
+  header.entrySize = sizeof(WifiCredential);
+  header.crc = crc32(_credentials, _count * sizeof(WifiCredential));
+
+  memcpy(out, &header, sizeof(header));
+  memcpy(out + sizeof(header), _credentials, _count * sizeof(WifiCredential));
+  return sizeof(header) + _count * sizeof(WifiCredential);
+}
+
+bool CredentialStore::unpack(const uint8_t *data, size_t size)
+{
+  CredentialRecordHeader header;
+  if(size < sizeof(header))
+    return false;
+  memcpy(&header, data, sizeof(header));
+
+  size_t entriesSize = header.count * sizeof(WifiCredential);
+  if(header.magic != CREDENTIAL_RECORD_MAGIC || header.version != CREDENTIAL_RECORD_VERSION ||
+     header.entrySize != sizeof(WifiCredential) || header.count > CREDENTIALS_MAX || size != sizeof(header) + entriesSize)
+    return false;
+
+  if(crc32(data + sizeof(header), entriesSize) != header.crc)
+    return false;
+
+  memcpy(_credentials, data + sizeof(header), entriesSize);
+  _count = header.count;
+
+  for(uint8_t i = 0; i < _count; i++) //Never trust strings coming from flash
+  {
+    _credentials[i].ssid[SSID_MAX_LENGTH] = '\0';
+    _credentials[i].passwd[PASSWORD_MAX_LENGTH] = '\0';
+  }
+
+  rebuildIndex();
+  return true;
+}
+
+void CredentialStore::rebuildIndex()
+{
+  memset(_index, 0, sizeof(_index));
+
+  for(uint8_t i = 0; i < _count; i++)
+  {
+    _hashes[i] = hashString(_credentials[i].ssid);
+
+    uint32_t slot = _hashes[i] % CREDENTIAL_INDEX_SIZE;
+    while(_index[slot] != 0)
+      slot = (slot + 1) % CREDENTIAL_INDEX_SIZE;
+    _index[slot] = i + 1;
+  }
+}
+
+void CredentialStore::beginMatch()
+{
+  memset(_isSeen, 0, sizeof(_isSeen));
+}
+
+void CredentialStore::offer(const char *ssid, int8_t rssi)
+{
+  int8_t index = find(ssid);
+  if(index < 0)
+    return;
+
+  if(!_isSeen[index] || rssi > _bestRssi[index]) //Mesh networks show up once per AP, keep the strongest
+    _bestRssi[index] = rssi;
+  _isSeen[index] = true;
+}
+
+int16_t CredentialStore::score(uint8_t index) const
+{
+  const WifiCredential &credential = _credentials[index];
+  int16_t value = _isSeen[index] ? _bestRssi[index] : INT8_MIN;
+  value += credential.priority * CREDENTIAL_PRIORITY_WEIGHT;
+
+  if(credential.lastSuccess != 0)
+  {
+    bool isMostRecent = true;
+    for(uint8_t i = 0; i < _count; i++)
+      if(_credentials[i].lastSuccess > credential.lastSuccess)
+        isMostRecent = false;
+
+    if(isMostRecent)
+      value += CREDENTIAL_RECENT_BONUS;
+  }
+  return value;
+}
+
+uint8_t CredentialStore::rank(uint8_t *order, bool includeUnseen) const
+{
+  int16_t scores[CREDENTIALS_MAX];
+  uint8_t length = 0;
+
+  //Seen networks always go before unseen ones, insertion sort is enough for a handful of entries
+  for(uint8_t pass = 0; pass < (includeUnseen ? 2 : 1); pass++)
+  {
+    uint8_t start = length;
+    for(uint8_t i = 0; i < _count; i++)
+    {
+      if(_isSeen[i] != (pass == 0))
+        continue;
+
+      int16_t value = score(i);
+      uint8_t position = length++;
+      while(position > start && scores[position - 1] < value)
+      {
+        scores[position] = scores[position - 1];
+        order[position] = order[position - 1];
+        position--;
+      }
+      scores[position] = value;
+      order[position] = i;
+    }
+  }
+  return length;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <Arduino.h>
+#include "easyWifiHash.h"
+
+//SSID and Password default max length according to WLAN standart
+#define SSID_MAX_LENGTH     32
+#define PASSWORD_MAX_LENGTH 64
+
+#ifndef CREDENTIALS_MAX
+  #define CREDENTIALS_MAX 8 //Networks kept in NVS, the worst scored one is replaced when full
+#endif
+
+#define CREDENTIAL_INDEX_SIZE (CREDENTIALS_MAX * 2) //Hash index slots, half empty keeps probing short
+#define CREDENTIAL_PRIORITY_WEIGHT 10 //dB a priority level is worth when ranking networks
+#define CREDENTIAL_RECENT_BONUS    5  //dB bonus for the network that connected last
+
+#define CREDENTIAL_RECORD_MAGIC   0x45575752 //"EWWR"
+#define CREDENTIAL_RECORD_VERSION 1 //Bump when WifiCredential changes, older records are then ignored
+
+namespace EASYWIFI{
+
+//Record layout saved as a single NVS blob, keep it compact
+struct WifiCredential
+{
+  char ssid[SSID_MAX_LENGTH + 1];
+  char passwd[PASSWORD_MAX_LENGTH + 1];
+  bool isProtected;
+  uint8_t priority;     //Higher is tried first when signals are similar
+  uint32_t lastSuccess; //Logical timestamp of the last successful connection, 0 if never
+  uint8_t bssid[6];     //AP and channel of the last successful connection, lets the driver skip the scan
+  uint8_t channel;      //0 if unknown
+};
+
+//Leads the NVS record, followed by count WifiCredential
+struct CredentialRecordHeader
+{
+  uint32_t magic;
+  uint8_t version;
+  uint8_t count;
+  uint16_t entrySize; //sizeof(WifiCredential) when written, catches layout changes without a version bump
+  uint32_t crc;       //CRC-32 of the entries
+};
+
+#define CREDENTIAL_RECORD_MAX_SIZE (sizeof(CredentialRecordHeader) + CREDENTIALS_MAX * sizeof(WifiCredential))
+
+/*
+*   Holds up to CREDENTIALS_MAX networks and matches them against scan results.
+*   SSIDs are indexed by hash, so every scanned network costs one hash and one probe
+*   instead of a string compare against every stored network.
+*/
+class CredentialStore
+{
+  public:
+    uint8_t count() const { return _count; };
+    const WifiCredential& get(uint8_t index) const { return _credentials[index]; };
+
+    ///@return Index of the stored ssid, -1 if not found
+    int8_t find(const char *ssid) const;
+
+    ///@brief Adds the network or updates its password if already stored
+    ///@return Index of the credential, -1 if ssid is invalid
+    int8_t add(const char *ssid, const char *passwd, bool isProtected, uint8_t priority = 0);
+    bool remove(const char *ssid);
+    void clear();
+    void markSuccess(uint8_t index);
+    void setLastAccessPoint(uint8_t index, const uint8_t *bssid, uint8_t channel);
+
+    //NVS persistence as a single record, out must hold CREDENTIAL_RECORD_MAX_SIZE
+    ///@return Bytes of the record
+    size_t pack(uint8_t *out) const;
+    ///@return False if the record is damaged or from another version, the store is left untouched
+    bool unpack(const uint8_t *data, size_t size);
+
+    //Scan matching, call beginMatch() then offer() for every scanned network
+    void beginMatch();
+    void offer(const char *ssid, int8_t rssi);
+    ///@param order Filled with credential indexes, best first
+    ///@param includeUnseen Also rank networks not found on scan, after the seen ones
+    ///@return Number of indexes written
+    uint8_t rank(uint8_t *order, bool includeUnseen = false) const;
+
+  private:
+    void rebuildIndex();
+    int16_t score(uint8_t index) const;
+
+    WifiCredential _credentials[CREDENTIALS_MAX];
+    uint8_t _count = 0;
+
+    uint32_t _hashes[CREDENTIALS_MAX];
+    uint8_t _index[CREDENTIAL_INDEX_SIZE] = {0}; //Credential index + 1, 0 is an empty slot
+    int8_t _bestRssi[CREDENTIALS_MAX]; //Strongest signal seen on current match
+    bool _isSeen[CREDENTIALS_MAX] = {false};
+};
+
+};
@@ -0,0 +1,89 @@
+//easyWifiDns.cpp
+
+#ifdef EASYWIFI_ASYNC_DNS
+
+#include "easyWifiDns.h"
+
+using namespace EASYWIFI;
+
+#define DNS_TYPE_A   1
+#define DNS_TYPE_ANY 255
+#define DNS_CLASS_IN 1
+
+bool CaptiveDnsServer::start(uint16_t port, const String &, const IPAddress &ip)
+{
+  //Answer template: pointer to the question name, A, IN, TTL, 4 bytes of IPv4
+  const uint8_t answer[DNS_ANSWER_LENGTH] = {
+    0xC0, DNS_HEADER_LENGTH,
+    0x00, DNS_TYPE_A,
+    0x00, DNS_CLASS_IN,
+    0x00, 0x00, 0x00, DNS_DEFAULT_TTL,
+    0x00, 0x04,
+    ip[0], ip[1], ip[2], ip[3]
+  };
+  memcpy(_answer, answer, sizeof(_answer));
+
+  _queries = 0;
+  _answers = 0;
+
+  if(!_udp.listen(port))
+    return false;
+
+  _udp.onPacket([this](AsyncUDPPacket &packet){
+    handlePacket(packet);
+  });
+  return true;
+}
+
+void CaptiveDnsServer::stop()
+{
+  _udp.close();
+}
+
+void CaptiveDnsServer::handlePacket(AsyncUDPPacket &packet)
+{
+  _queries++;
+
+  const uint8_t *query = packet.data();
+  size_t length = packet.length();
+
+  //Only standard queries with a single question, QR bit set means it is a response
+  if(length <= DNS_HEADER_LENGTH || (query[2] & 0xF8) != 0 || query[4] != 0 || query[5] != 1)
+    return;
+
+  //Walk the question name, compressed names are not valid in a query
+  size_t position = DNS_HEADER_LENGTH;
+  while(position < length && query[position] != 0)
+  {
+    if(query[position] & 0xC0)
+      return;
+    position += query[position] + 1;
+  }
+
+  position += 5; //Name terminator + type + class
+  if(position > length || position + DNS_ANSWER_LENGTH > DNS_MAX_PACKET_LENGTH)
+    return;
+
+  uint16_t type = (query[position - 4] << 8) | query[position - 3];
+  bool hasAnswer = type == DNS_TYPE_A || type == DNS_TYPE_ANY; //AAAA and others get an empty NOERROR
+
+  //Header and question are copied back, additional records (EDNS) are dropped
+  uint8_t response[DNS_MAX_PACKET_LENGTH];
+  memcpy(response, query, position);
+  response[2] = 0x84 | (query[2] & 0x01); //Response, authoritative, keep recursion desired
+  response[3] = 0x80; //Recursion available, no error
+  response[6] = 0;
+  response[7] = hasAnswer ? 1 : 0; //Answer count
+  memset(response + 8, 0, 4); //Authority and additional counts
+
+  if(hasAnswer)
+  {
+    memcpy(response + position, _answer, DNS_ANSWER_LENGTH);
+    position += DNS_ANSWER_LENGTH;
+  }
+
+  packet.write(response, position);
+  _answers++;
+}
+
+#endif
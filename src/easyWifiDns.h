@@ -0,0 +1,43 @@
+#pragma once
+
+#ifdef EASYWIFI_ASYNC_DNS
+
+#include <Arduino.h>
+#include <AsyncUDP.h>
+
+#define DNS_HEADER_LENGTH     12
+#define DNS_MAX_PACKET_LENGTH 512 //Plain UDP DNS limit
+#define DNS_ANSWER_LENGTH     16  //Name pointer + type + class + TTL + length + IPv4
+#define DNS_DEFAULT_TTL       60
+
+namespace EASYWIFI{
+
+/*
+*   Captive portal DNS that resolves every name to the AP IP.
+*   Queries are answered from the AsyncUDP task as they arrive, so the answer rate doesn't depend
+*   on how often the user calls update(). The answer record is built once on start, each reply is
+*   just the question copied back plus that template.
+*/
+class CaptiveDnsServer
+{
+  public:
+    ///@param domainName Kept for DNSServer compatibility, every name is answered like "*"
+    bool start(uint16_t port, const String &domainName, const IPAddress &ip);
+    void stop();
+    void processNextRequest() {}; //Nothing to poll, kept for DNSServer compatibility
+
+    uint32_t get_queries() const { return _queries; };
+    uint32_t get_answers() const { return _answers; };
+
+  private:
+    void handlePacket(AsyncUDPPacket &packet);
+
+    AsyncUDP _udp;
+    uint8_t _answer[DNS_ANSWER_LENGTH];
+    volatile uint32_t _queries = 0;
+    volatile uint32_t _answers = 0;
+};
+
+};
+
+#endif
@@ -0,0 +1,96 @@
+//easyWifiFileCache.cpp
+
+#ifdef EASYWIFI_LITTLEFS
+
+#include "easyWifiFileCache.h"
+#include "easyWifiHash.h"
+
+using namespace EASYWIFI;
+
+const CachedFile* FileCache::get(fs::FS &fs, const char *path)
+{
+  for(CachedFile &file : _files)
+  {
+    if(file.data && strcmp(file.path, path) == 0)
+    {
+      _hits++;
+      file.lastUse = ++_useCounter;
+      return &file;
+    }
+  }
+
+  _misses++;
+  if(strlen(path) >= FILE_CACHE_PATH_LENGTH - 3)
+    return nullptr;
+
+  char gzipPath[FILE_CACHE_PATH_LENGTH];
+  snprintf(gzipPath, sizeof(gzipPath), "%s.gz", path);
+
+  bool isGzip = fs.exists(gzipPath);
+  if(!isGzip && !fs.exists(path))
+    return nullptr;
+
+  File source = fs.open(isGzip ? gzipPath : path, "r");
+  if(!source || source.isDirectory())
+    return nullptr;
+
+  size_t length = source.size();
+  CachedFile *file = reserveSlot(length);
+  if(file == nullptr) //Too big for the cache, caller streams it from flash
+  {
+    source.close();
+    return nullptr;
+  }
+
+  std::shared_ptr<uint8_t> data(new (std::nothrow) uint8_t[length], std::default_delete<uint8_t[]>());
+  if(!data || source.read(data.get(), length) != length)
+  {
+    source.close();
+    return nullptr;
+  }
+
+  uint32_t hash = hashBytes(data.get(), length);
+
+  file->data = data;
+  file->length = length;
+  file->isGzip = isGzip;
+  file->lastWrite = source.getLastWrite();
+  file->lastUse = ++_useCounter;
+  strcpy(file->path, path);
+  snprintf(file->etag, sizeof(file->etag), "\"%08x\"", (unsigned int)hash);
+  source.close();
+
+  _bytesCached += length;
+  _bytesReadFromFlash += length;
+  return file;
+}
+
+/// @return Empty slot after evicting least recently used files until length fits, nullptr if it never fits
+CachedFile* FileCache::reserveSlot(size_t length)
+{
+  if(length > FILE_CACHE_MAX_BYTES)
+    return nullptr;
+
+  while(true)
+  {
+    CachedFile *empty = nullptr;
+    CachedFile *oldest = nullptr;
+
+    for(CachedFile &file : _files)
+    {
+      if(!file.data)
+        empty = &file;
+      else if(oldest == nullptr || file.lastUse < oldest->lastUse)
+        oldest = &file;
+    }
+
+    if(empty && _bytesCached + length <= FILE_CACHE_MAX_BYTES)
+      return empty;
+
+    //Responses still holding the data keep it alive until they finish
+    _bytesCached -= oldest->length;
+    oldest->data.reset();
+  }
+}
+
+#endif
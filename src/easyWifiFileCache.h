@@ -0,0 +1,59 @@
+#pragma once
+
+#ifdef EASYWIFI_LITTLEFS
+
+#include <Arduino.h>
+#include <FS.h>
+#include <memory> //shared_ptr
+#include <new> //nothrow
+
+#ifndef FILE_CACHE_MAX_BYTES
+  #define FILE_CACHE_MAX_BYTES 16384 //RAM used by cached files, bigger files are streamed from flash
+#endif
+#ifndef FILE_CACHE_SLOTS
+  #define FILE_CACHE_SLOTS 4
+#endif
+#define FILE_CACHE_PATH_LENGTH 48
+
+namespace EASYWIFI{
+
+struct CachedFile
+{
+  char path[FILE_CACHE_PATH_LENGTH]; //Requested path, without .gz
+  std::shared_ptr<uint8_t> data; //Shared with responses still sending it, survives eviction
+  size_t length;
+  bool isGzip;
+  time_t lastWrite;
+  char etag[12]; //Content hash, quoted
+  uint32_t lastUse;
+};
+
+/*
+*   Size capped LRU cache of the portal files, so repeated page loads never touch flash.
+*   Pre-compressed .gz siblings are preferred, they are ~4x smaller to keep and to send.
+*/
+class FileCache
+{
+  public:
+    ///@return Cached file, loaded from fs on a miss, nullptr if missing or too big to cache
+    const CachedFile* get(fs::FS &fs, const char *path);
+
+    uint32_t get_hits() const { return _hits; };
+    uint32_t get_misses() const { return _misses; };
+    size_t get_bytesCached() const { return _bytesCached; };
+    size_t get_bytesReadFromFlash() const { return _bytesReadFromFlash; };
+
+  private:
+    CachedFile* reserveSlot(size_t length);
+
+    CachedFile _files[FILE_CACHE_SLOTS];
+    uint32_t _useCounter = 0;
+    uint32_t _hits = 0;
+    uint32_t _misses = 0;
+    size_t _bytesCached = 0;
+    size_t _bytesReadFromFlash = 0;
+};
+
+};
+
+#endif
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <Arduino.h>
+
+namespace EASYWIFI{
+
+static constexpr uint32_t HASH_SEED = 2166136261u;
+
+/// @brief FNV-1a, cheap enough to hash every scanned SSID or served file
+inline uint32_t hashBytes(const void *data, size_t length, uint32_t hash = HASH_SEED)
+{
+  const uint8_t *bytes = static_cast<const uint8_t*>(data);
+  while(length--)
+  {
+    hash ^= *bytes++;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+/// @brief CRC-32 (IEEE), bitwise so it needs no table, only used on small NVS records
+inline uint32_t crc32(const void *data, size_t length)
+{
+  const uint8_t *bytes = static_cast<const uint8_t*>(data);
+  uint32_t crc = 0xFFFFFFFFu;
+  while(length--)
+  {
+    crc ^= *bytes++;
+    for(uint8_t bit = 0; bit < 8; bit++)
+      crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+  }
+  return ~crc;
+}
+
+inline uint32_t hashString(const char *text, uint32_t hash = HASH_SEED)
+{
+  while(*text)
+  {
+    hash ^= (uint8_t)*text++;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+};
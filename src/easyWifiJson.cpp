@@ -0,0 +1,163 @@
+//easyWifiJson.cpp
+
+#include "easyWifiJson.h"
+
+using namespace EASYWIFI;
+
+size_t ScanJsonWriter::write(uint8_t *buffer, size_t maxLen)
+{
+  size_t written = 0;
+
+  while(written < maxLen)
+  {
+    if(_entryPosition == _entryLength) //Current entry fully sent, render the next one
+    {
+      if(_isClosed)
+        break;
+
+      renderNextEntry();
+      continue;
+    }
+
+    size_t chunk = _entryLength - _entryPosition;
+    if(chunk > maxLen - written) 
+      chunk = maxLen - written;
+
+    memcpy(buffer + written, _entry + _entryPosition, chunk);
+    _entryPosition += chunk;
+    written += chunk;
+  }
+
+  return written;
+}
+
+void ScanJsonWriter::renderNextEntry()
+{
+  _entryLength = 0;
+  _entryPosition = 0;
+
+  if(_nextNetwork == 0) 
+    _entry[_entryLength++] = '[';
+
+  if(_nextNetwork >= _table.count()) //No more networks, close the array
+  {
+    _entry[_entryLength++] = ']';
+    _isClosed = true;
+    return;
+  }
+
+  if(_entryLength == 0) 
+    _entry[_entryLength++] = ','; // Comma if not the first element
+
+  size_t available = sizeof(_entry) - _entryLength;
+  _entryLength += renderNetwork(_table.get(_nextNetwork++), _entry + _entryLength, available);
+}
+
+size_t ScanJsonWriter::renderNetwork(const ScanEntry &network, char *out, size_t outLen)
+{
+  char ssid[JSON_ENTRY_MAX_LENGTH];
+  escapeString(network.ssid, ssid, sizeof(ssid));
+
+  int length = snprintf(out, outLen, "{\"ssid\":\"%s\",\"rssi\":%d,\"isProtected\":%d,\"aps\":%u}",
+    ssid, network.rssi, network.isProtected, network.apCount);
+
+  if(length <= 0)
+    return 0;
+
+  return (size_t)length < outLen ? length : outLen - 1; //snprintf truncates, keep what fits
+}
+
+//Appends text to out, false once it doesn't fit anymore
+static bool append(char *out, size_t outLen, size_t &length, const char *text, size_t textLength)
+{
+  if(length + textLength >= outLen)
+    return false;
+
+  memcpy(out + length, text, textLength);
+  length += textLength;
+  out[length] = '\0';
+  return true;
+}
+
+static bool isChanged(const ScanEntry &a, const ScanEntry &b)
+{
+  return a.rssi != b.rssi || a.isProtected != b.isProtected || a.apCount != b.apCount;
+}
+
+size_t ScanJsonWriter::writeDelta(const ScanTable &current, const ScanTable &previous, char *out, size_t outLen)
+{
+  static const char *const SECTIONS[] = { "{\"added\":[", "],\"changed\":[", "],\"removed\":[" };
+  enum { ADDED, CHANGED, REMOVED };
+
+  char entry[JSON_ENTRY_MAX_LENGTH];
+  size_t length = 0;
+
+  for(uint8_t section = ADDED; section <= REMOVED; section++)
+  {
+    if(!append(out, outLen, length, SECTIONS[section], strlen(SECTIONS[section])))
+      return 0;
+
+    //Removed networks are the ones in the previous scan missing from the current one
+    const ScanTable &table = section == REMOVED ? previous : current;
+    const ScanTable &other = section == REMOVED ? current : previous;
+    bool isFirst = true;
+
+    for(uint8_t i = 0; i < table.count(); i++)
+    {
+      const ScanEntry &network = table.get(i);
+      int8_t match = other.find(network.ssid);
+      size_t entryLength;
+
+      if(section == ADDED && match < 0)
+        entryLength = renderNetwork(network, entry, sizeof(entry));
+      else if(section == CHANGED && match >= 0 && isChanged(network, other.get(match)))
+        entryLength = renderNetwork(network, entry, sizeof(entry));
+      else if(section == REMOVED && match < 0) //Only the SSID is needed to drop it
+      {
+        entry[0] = '"';
+        entryLength = 1 + escapeString(network.ssid, entry + 1, sizeof(entry) - 2);
+        entry[entryLength++] = '"';
+      }
+      else
+        continue;
+
+      if((!isFirst && !append(out, outLen, length, ",", 1)) || !append(out, outLen, length, entry, entryLength))
+        return 0;
+      isFirst = false;
+    }
+  }
+
+  return append(out, outLen, length, "]}", 2) ? length : 0;
+}
+
+size_t ScanJsonWriter::escapeString(const char *in, char *out, size_t outLen)
+{
+  static const char HEX_DIGITS[] = "0123456789abcdef";
+  size_t length = 0;
+
+  for(; *in; in++)
+  {
+    uint8_t c = *in;
+    size_t needed = (c == '"' || c == '\\') ? 2 : (c < 0x20 ? 6 : 1);
+    if(length + needed >= outLen)
+      break;
+
+    if(c == '"' || c == '\\')
+    {
+      out[length++] = '\\';
+      out[length++] = c;
+    }
+    else if(c < 0x20) //Control chars must be escaped as \u00XX
+    {
+      memcpy(out + length, "\\u00", 4);
+      out[length + 4] = HEX_DIGITS[c >> 4];
+      out[length + 5] = HEX_DIGITS[c & 0x0F];
+      length += 6;
+    }
+    else
+      out[length++] = c;
+  }
+
+  out[length] = '\0';
+  return length;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Arduino.h>
+#include "easyWifiScan.h"
+
+//Biggest entry: separator + {"ssid":"<32 chars escaped as \u00XX>","rssi":-128,"isProtected":1,"aps":255} + closing bracket
+#define JSON_ENTRY_MAX_LENGTH 256
+
+namespace EASYWIFI{
+
+/*
+*   Streams the scan table as a JSON array straight into the buffers handed by AsyncWebServer.
+*   Only one entry is rendered at a time in a fixed buffer, so no String is built per network
+*   and the response size doesn't depend on how many networks are around.
+*/
+class ScanJsonWriter
+{
+  public:
+    ///@param table Scan results, must outlive the writer and stay unchanged, a snapshot for responses
+    explicit ScanJsonWriter(const ScanTable &table) : _table(table) {};
+
+    ///@return Bytes written to buffer, 0 when the whole array was sent
+    size_t write(uint8_t *buffer, size_t maxLen);
+
+    ///@return Chars written to out, SSID escaped as JSON string content (without quotes)
+    static size_t escapeString(const char *in, char *out, size_t outLen);
+    ///@return Chars written to out, one network as a JSON object
+    static size_t renderNetwork(const ScanEntry &network, char *out, size_t outLen);
+
+    /// @brief Networks added, changed or removed between two scans, as {"added":[..],"changed":[..],"removed":["ssid",..]}
+    ///@return Chars written to out, 0 if the delta doesn't fit and the full list should be sent instead
+    static size_t writeDelta(const ScanTable &current, const ScanTable &previous, char *out, size_t outLen);
+
+  private:
+    void renderNextEntry();
+
+    const ScanTable &_table;
+    uint8_t _nextNetwork = 0;
+    bool _isClosed = false;
+
+    char _entry[JSON_ENTRY_MAX_LENGTH];
+    uint16_t _entryLength = 0;
+    uint16_t _entryPosition = 0;
+};
+
+};
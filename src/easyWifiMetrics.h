@@ -0,0 +1,109 @@
+#pragma once
+
+#include <Arduino.h>
+
+namespace EASYWIFI{
+
+//Routes counted on EasyWifiMetrics::requests
+enum class ROUTE : uint8_t {
+  START_SCAN,
+  SCAN_STATUS,
+  START_WIFI,
+  WIFI_STATUS,
+  STATIC_FILE,
+  CAPTIVE_PROBE,
+  REDIRECT,
+  METRICS,
+  TRACE,
+  COUNT, //Not a route, size of the counters array
+};
+
+inline const char* toString(ROUTE route)
+{
+  switch(route)
+  {
+    case ROUTE::START_SCAN:    return "start_scan";
+    case ROUTE::SCAN_STATUS:   return "scan_status";
+    case ROUTE::START_WIFI:    return "start_wifi";
+    case ROUTE::WIFI_STATUS:   return "wifi_status";
+    case ROUTE::STATIC_FILE:   return "static_file";
+    case ROUTE::CAPTIVE_PROBE: return "captive_probe";
+    case ROUTE::REDIRECT:      return "redirect";
+    case ROUTE::METRICS:       return "metrics";
+    case ROUTE::TRACE:         return "trace";
+    case ROUTE::COUNT:         break;
+  }
+  return "unknown";
+}
+
+//Min, max and last duration of a phase in microseconds, recording is a few compares
+struct PhaseTiming
+{
+  uint32_t min = 0;
+  uint32_t max = 0;
+  uint32_t last = 0;
+  uint32_t count = 0;
+
+  void record(uint32_t duration)
+  {
+    if(count == 0 || duration < min) min = duration;
+    if(duration > max) max = duration;
+    last = duration;
+    count++;
+  }
+};
+
+//Records the lifetime of the scope, for phases with several return paths
+class PhaseTimer
+{
+  public:
+    explicit PhaseTimer(PhaseTiming &timing) : _timing(timing), _start(micros()) {};
+    ~PhaseTimer() { _timing.record(micros() - _start); };
+
+  private:
+    PhaseTiming &_timing;
+    uint32_t _start;
+};
+
+//millis() when each boot phase was first reached, 0 if not reached yet
+struct BootTimeline
+{
+  uint32_t setup = 0;
+  uint32_t nvsRead = 0;
+  uint32_t portalUp = 0;  //AP, DNS and web server accepting clients
+  uint32_t firstScan = 0;
+  uint32_t connected = 0;
+
+  ///@return True only the first time, when the phase is actually marked
+  static bool mark(uint32_t &phase)
+  {
+    if(phase != 0)
+      return false;
+    phase = millis();
+    return true;
+  }
+};
+
+struct EasyWifiMetrics
+{
+  PhaseTiming scan;        //scanNetworks() until results are ready
+  PhaseTiming connect;     //connectWifi() until connected, successful connections only
+  PhaseTiming portalStart; //startCaptivePortal()
+  PhaseTiming nvsRead;
+  PhaseTiming nvsWrite;
+  BootTimeline boot;
+
+  uint32_t requests[(uint8_t)ROUTE::COUNT] = {0};
+  uint32_t nvsWritesSkipped = 0; //Saves with nothing changed, no flash written
+  uint32_t failedConnects = 0; //Every failed attempt, including fallbacks to other stored networks
+  uint32_t minFreeHeap = 0;    //Lowest free heap seen while the portal was up, 0 if it never started
+
+  //Roaming, stay 0 unless set_Roaming(true)
+  uint32_t roamScans = 0;   //Scans started because the link got weak
+  uint32_t roams = 0;       //Successful moves to a better AP of the same network
+  uint32_t failedRoams = 0; //Moves that couldn't join the new AP
+  int8_t rssiAverage = 0;   //Smoothed RSSI of the current link
+  int8_t rssiMin = 0;       //Lowest smoothed RSSI seen while connected
+};
+
+};
@@ -6,37 +6,115 @@ using namespace EASYWIFI;
   #include "frontend.h"
 #endif
 
+//Connectivity checks of Android, ChromeOS, Apple, Windows and Firefox. All of them get the same 302 to the portal:
+//any answer but the expected 204 or "Success" marks the network captive, and the redirect lands the sheet on the portal
+//without another probe. Only listed to count them apart from other redirects
+static const char* const CAPTIVE_PROBE_PATHS[] = {
+  "/generate_204", "/gen_204", "/hotspot-detect.html", "/library/test/success.html",
+  "/connecttest.txt", "/ncsi.txt", "/redirect", "/canonical.html", "/success.txt",
+};
+
+static bool isCaptiveProbe(const char *url)
+{
+  for(const char *path : CAPTIVE_PROBE_PATHS)
+    if(strcmp(url, path) == 0)
+      return true;
+  return false;
+}
+
+//Same types gen_frontend_header.py uses for the embedded files
+struct AssetType { const char *extension; const char *mimeType; };
+static const AssetType ASSET_TYPES[] = {
+  {".htm", "text/html"}, {".html", "text/html"}, {".css", "text/css"}, {".js", "text/javascript"},
+  {".svg", "image/svg+xml"}, {".png", "image/png"}, {".ico", "image/x-icon"}, {".json", "application/json"},
+};
+
+//Only urls that can be a portal file are looked up, probes and random paths go straight to the redirect
+static bool isAssetUrl(const char *url)
+{
+  if(strcmp(url, "/") == 0)
+    return true;
+  if(isCaptiveProbe(url))
+    return false;
+
+  const char *extension = strrchr(url, '.');
+  if(extension == nullptr || strchr(extension, '/') != nullptr)
+    return false;
+
+  for(const AssetType &type : ASSET_TYPES)
+    if(strcmp(extension, type.extension) == 0)
+      return true;
+  return false;
+}
+
 void EasyWifi::startCaptivePortal()
 {
+  StateLock lock(_stateMutex);
   if(_isCaptivePortalEnabled) //If server is already running
     return;
 
   ESP_LOGI(APP, "Starting Captive Portal");
+  PhaseTimer timer(_metrics.portalStart);
 
   WiFi.mode(WIFI_AP_STA); //AP for cap portal STA for scanNetworks - Redundant but better explicited than not
 
-  scanNetworks(); //Scan networks to show on first captive portal opening
-  
   WiFi.softAP(_CaptivePortalSSID, _CaptivePortalPassword);
+
+  //Built once, every redirect reuses them instead of formatting the IP per request
+  IPAddress apIP = WiFi.softAPIP();
+  snprintf(_portalHost, sizeof(_portalHost), "%u.%u.%u.%u", apIP[0], apIP[1], apIP[2], apIP[3]);
+  snprintf(_portalUrl, sizeof(_portalUrl), "http://%s/", _portalHost);
+  
+  buildPortalServers();
+  _dnsServer->start(53, "*", apIP);
   
+  serveStaticRoutes();
+
+  _server->begin();
+  BootTimeline::mark(_metrics.boot.portalUp);
+  _pushedScanStatus = _scanStatus; //Clients connecting to /events get the current state from onConnect
+  _pushedWifiStatus = _wifiStatus;
+  _isCaptivePortalEnabled = true;
+  _serverStartTime = millis();
+  _trace.record(TRACE_EVENT::PORTAL_START);
+
+  //Async scan to show on first captive portal opening, AP is already reachable meanwhile.
+  //Started by update(), after a connection attempt that may already be running
+  if(!isScanCacheValid(publishedScan()) && _scanStatus != SCAN_STATUS::RUNNING)
+    setScanStatus(SCAN_STATUS::READY_TO_SCAN);
+
+  ESP_LOGI(APP,"Captive Portal initializated at: %s\n",_portalUrl);
+}
+
+void EasyWifi::buildPortalServers()
+{
+#ifdef EASYWIFI_STATIC_ARENA
+  if(_server) //Built on the first start, objects and routes are kept across logouts
+    return;
+
+  _server = new (_serverArena) AsyncWebServer(80);
+  _dnsServer = new (_dnsServerArena) PortalDnsServer();
+#else
   _server = new AsyncWebServer(80);
-  _dnsServer = new DNSServer();
-  _dnsServer->start(53, "*", WiFi.softAPIP());
+  _dnsServer = new PortalDnsServer();
+#endif
 
   serveScanRoutes();
   serveWifiRoutes();
-  
+  serveEventRoutes();
+  serveMetricsRoutes();
+  serveTraceRoutes();
   
   _server->onNotFound([this](AsyncWebServerRequest *request) {
+    const char *url = request->url().c_str();
+    if(isAssetUrl(url) && staticAssetController(request, url)) //Frontend files are looked up here instead of one route each
+    {
+      countRequest(ROUTE::STATIC_FILE);
+      return;
+    }
+
     redirectToIpController(request);
   });
-  
-  serveStaticRoutes();
-
-  _server->begin();
-  _isCaptivePortalEnabled = true;
-  _serverStartTime = millis();
-  ESP_LOGI(APP,"Captive Portal initializated at: http://%s\n",WiFi.softAPIP().toString().c_str());
 }
 
 void EasyWifi::serveScanRoutes()
@@ -44,12 +122,16 @@ void EasyWifi::serveScanRoutes()
   _server->on("/start-scan", HTTP_GET, [this](AsyncWebServerRequest *request)
   {
     ESP_LOGV(APP,"Scan Requested");
-    _scanStatus = SCAN_STATUS::READY_TO_SCAN;
+    countRequest(ROUTE::START_SCAN);
+
+    _commands.push(PORTAL_COMMAND::START_SCAN);
+
     request->send(200,"text/plain","WiFi Scan Started");
   });
 
   //After client try to scan the network this route will be called to check the status
   _server->on("/scan-status", HTTP_GET, [this](AsyncWebServerRequest *request){
+    countRequest(ROUTE::SCAN_STATUS);
     checkScanController(request);
   });
 }
@@ -58,41 +140,174 @@ void EasyWifi::serveWifiRoutes()
 {
   _server->on("/start-wifi", HTTP_POST, [this](AsyncWebServerRequest *request) {
     ESP_LOGV(APP,"WiFi Connection Requested from route");
+    countRequest(ROUTE::START_WIFI);
     SaveWiFiDataController(request);
   });
 
   //After client try to connect to wifi this route will be called to check the status
   _server->on("/wifi-status",HTTP_GET,[this](AsyncWebServerRequest *request){
+    countRequest(ROUTE::WIFI_STATUS);
     checkWiFiStatusController(request);
   });
 }
 
+//Pushes status changes instead of waiting for the next poll, polling routes are kept as fallback
+void EasyWifi::serveEventRoutes()
+{
+  if(!BuildConfig::hasEvents) //_events stays null, pushStatusEvents() does nothing
+    return;
+
+  _events = new AsyncEventSource("/events");
+
+  //New clients get the current state right away
+  _events->onConnect([this](AsyncEventSourceClient *client){
+    client->send(toString(_scanStatus), "scan");
+    client->send(toString(_wifiStatus), "wifi");
+  });
+
+  _server->addHandler(_events);
+}
+
+//Called from update(), so every event is sent from the same task no matter who changed the state
+void EasyWifi::pushStatusEvents()
+{
+  if(!BuildConfig::hasEvents || !_events || !_isCaptivePortalEnabled) //Without events the rest is dropped, static buffer included
+    return;
+
+  if(_scanStatus != _pushedScanStatus)
+  {
+    _pushedScanStatus = _scanStatus;
+
+    if(_scanStatus == SCAN_STATUS::FINISHED && _events->count() > 0) //Results go first, they usually fit in one event
+    {
+      static char json[EVENT_JSON_MAX_LENGTH];
+      const ScanSnapshot &scan = publishedScan(); //update() is the only writer, no need to hold it here
+      ScanJsonWriter writer(scan.table);
+      size_t length = writer.write(reinterpret_cast<uint8_t*>(json), sizeof(json) - 1);
+
+      if(writer.write(reinterpret_cast<uint8_t*>(json + length), 1) == 0) //Nothing left, the whole array fit
+      {
+        json[length] = '\0';
+        _events->send(json, "networks", scan.generation); //Event id tells the client which generation it holds
+      }
+    }
+
+    _events->send(toString(_scanStatus), "scan");
+  }
+
+  if(_wifiStatus != _pushedWifiStatus)
+  {
+    _pushedWifiStatus = _wifiStatus;
+    _events->send(toString(_wifiStatus), "wifi");
+  }
+}
+
+void EasyWifi::serveMetricsRoutes()
+{
+#ifdef EASYWIFI_METRICS_ROUTE
+  _server->on("/metrics", HTTP_GET, [this](AsyncWebServerRequest *request){
+    countRequest(ROUTE::METRICS);
+    metricsController(request);
+  });
+#endif
+}
+
+//JSON snapshot of get_Metrics(), times in microseconds
+void EasyWifi::metricsController(AsyncWebServerRequest *request)
+{
+  char json[METRICS_JSON_MAX_LENGTH];
+  size_t length = 0;
+
+  const struct { const char *name; const PhaseTiming &timing; } phases[] = {
+    {"scan", _metrics.scan}, {"connect", _metrics.connect}, {"portal_start", _metrics.portalStart},
+    {"nvs_read", _metrics.nvsRead}, {"nvs_write", _metrics.nvsWrite},
+  };
+
+  length += snprintf(json + length, sizeof(json) - length, "{\"timings\":{");
+  for(size_t i = 0; i < sizeof(phases) / sizeof(phases[0]) && length < sizeof(json); i++)
+  {
+    const PhaseTiming &timing = phases[i].timing;
+    length += snprintf(json + length, sizeof(json) - length, "%s\"%s\":{\"min\":%" PRIu32 ",\"max\":%" PRIu32 ",\"last\":%" PRIu32 ",\"count\":%" PRIu32 "}",
+      i ? "," : "", phases[i].name, timing.min, timing.max, timing.last, timing.count);
+  }
+
+  const BootTimeline &boot = _metrics.boot;
+  if(length < sizeof(json))
+    length += snprintf(json + length, sizeof(json) - length,
+      "},\"boot\":{\"setup\":%" PRIu32 ",\"nvs_read\":%" PRIu32 ",\"portal_up\":%" PRIu32 ",\"first_scan\":%" PRIu32 ",\"connected\":%" PRIu32 "},\"requests\":{",
+      boot.setup, boot.nvsRead, boot.portalUp, boot.firstScan, boot.connected);
+  for(uint8_t i = 0; i < (uint8_t)ROUTE::COUNT && length < sizeof(json); i++)
+    length += snprintf(json + length, sizeof(json) - length, "%s\"%s\":%" PRIu32, i ? "," : "", toString((ROUTE)i), _metrics.requests[i]);
+
+  if(length < sizeof(json))
+    length += snprintf(json + length, sizeof(json) - length, "},\"nvs_writes_skipped\":%" PRIu32 ",\"failed_connects\":%" PRIu32 ",\"min_free_heap\":%" PRIu32 ",\"free_heap\":%" PRIu32,
+      _metrics.nvsWritesSkipped, _metrics.failedConnects, _metrics.minFreeHeap, ESP.getFreeHeap());
+
+  if(length < sizeof(json))
+    length += snprintf(json + length, sizeof(json) - length, ",\"roaming\":{\"scans\":%" PRIu32 ",\"roams\":%" PRIu32 ",\"failed\":%" PRIu32 ",\"rssi\":%d,\"rssi_min\":%d}}",
+      _metrics.roamScans, _metrics.roams, _metrics.failedRoams, _metrics.rssiAverage, _metrics.rssiMin);
+
+  if(length >= sizeof(json)) //snprintf counts what didn't fit, a cut JSON is never sent
+  {
+    ESP_LOGE(APP,"Metrics don't fit in %d bytes, raise METRICS_JSON_MAX_LENGTH", METRICS_JSON_MAX_LENGTH);
+    request->send(500, "text/plain", "Metrics don't fit METRICS_JSON_MAX_LENGTH");
+    return;
+  }
+  request->send(200, "application/json", json);
+}
+
+void EasyWifi::serveTraceRoutes()
+{
+#ifdef EASYWIFI_TRACE_ROUTE
+  _server->on("/trace", HTTP_GET, [this](AsyncWebServerRequest *request){
+    countRequest(ROUTE::TRACE);
+    traceController(request);
+  });
+#endif
+}
+
+//Raw trace records, oldest first, decoded on the host by decode_trace.py
+void EasyWifi::traceController(AsyncWebServerRequest *request)
+{
+  AsyncResponseStream *response = request->beginResponseStream("application/octet-stream");
+  _trace.dump(*response);
+  response->addHeader("Cache-Control", "no-store");
+  request->send(response);
+}
+
 //Do not request more often than 3-5 seconds
 void EasyWifi::checkScanController(AsyncWebServerRequest *request)
 {
-  switch(_scanStatus)
+  //Status first, results are published before FINISHED so the held scan is never older than it.
+  //Held, not copied: update() publishes into the other slot while this response is still streaming
+  SCAN_STATUS status = _scanStatus;
+  ScanSnapshotRef scan = readScanResults();
+
+  switch(status)
   {
-    case SCAN_STATUS::NOT_RUNNING: //If Scan is not running, we should change the variable to start the scan
-      _scanStatus = SCAN_STATUS::READY_TO_SCAN; //Variable is watched on loop
-      request->send(202, "text/plain", "Scan will start soon...");
+    case SCAN_STATUS::NOT_RUNNING: //If Scan is not running, ask update() to start it
+      _commands.push(PORTAL_COMMAND::START_SCAN);
+      sendScanPending(request, scan, "Scan will start soon...");
     break;
 
     case SCAN_STATUS::RUNNING:
-      request->send(202, "text/plain", "Scanning...");
+      sendScanPending(request, scan, "Scanning...");
     break;
 
     case SCAN_STATUS::READY_TO_SCAN:
-      request->send(202, "text/plain", "Scan will start soon...");
+      sendScanPending(request, scan, "Scan will start soon...");
     break;
 
     case SCAN_STATUS::FINISHED: //That's what we want
-      if(_avaibleNetworks > 0)
-        request->send(200, "application/json", sendJsonNetworks());
-      else //!TODO: is not an error, just send to frontend handle
-        ESP_LOGE(APP,"Error, no networks found to process Json, _avaibleNetworks: %d\n",_avaibleNetworks);
-
-      _scanStatus = SCAN_STATUS::NOT_RUNNING;
-      _avaibleNetworks = -1; //Reset variable
+      if(!isScanCacheValid(*scan)) //Results are too old, rescan before answering
+      {
+        _commands.push(PORTAL_COMMAND::START_SCAN);
+        sendScanPending(request, scan, "Scan will start soon...");
+        break;
+      }
+
+      //Results stay cached until TTL expires, so every client reads the same scan
+      sendJsonNetworks(request, scan); //Empty list is handled by the frontend
     break;
 
     default:
@@ -113,7 +328,7 @@ void EasyWifi::SaveWiFiDataController(AsyncWebServerRequest *request)
   //Get all data from the form
   String ssid = request->arg("ssid");
   String passwd = request->arg("password");
-  _isProtected = request->arg("isProtected") == "1"; //"0" = Open Network, "1" = Encrypted Network
+  bool isProtected = request->arg("isProtected") == "1"; //"0" = Open Network, "1" = Encrypted Network
 //TODO: try to use only if(pass is empty, network is open
   //Check if the SSID is Empty
   if(ssid.length() <= 0)
@@ -122,29 +337,64 @@ void EasyWifi::SaveWiFiDataController(AsyncWebServerRequest *request)
     return;
   }
 
-  if(_isProtected && passwd.length() < 8)
+  if(isProtected && passwd.length() < 8)
   {
     request->send(400, "text/plain", "Password must have at least 8 characters");
     return;
   }
 
-  ssid.toCharArray(_ssidStored, SSID_MAX_LENGTH);
-  passwd.toCharArray(_passwdStored, PASSWORD_MAX_LENGTH);
+  //One portal attempt at a time, a second phone is told so instead of replacing the network being tried.
+  //A stored network tried in background gives way. Network in use is only replaced by update(), the handler fills the staging buffer instead
+  bool isPortalAttemptRunning = _wifiStatus == WIFI_STATUS::CONNECTING && _isPortalAttempt;
+  if(_wifiStatus == WIFI_STATUS::READY_TO_CONNECT || isPortalAttemptRunning || _isStagingBusy.exchange(true))
+  {
+    request->send(409, "text/plain", "Another connection attempt is running, try again when it ends");
+    return;
+  }
+
+  _stagedSession = esp_random() | 1; //Never 0, that means no session
 
-//!TODO: what this log is about??
-  ESP_LOGV(APP,"ssid found in : %s\n", _ssidStored);
+  ssid.toCharArray(_stagedSsid, sizeof(_stagedSsid));
+  passwd.toCharArray(_stagedPasswd, sizeof(_stagedPasswd));
+  _stagedIsProtected = isProtected;
 
-  request->send(200, "text/plain", "Data received, trying to connect to Wi-Fi...");
+  if(!_commands.push(PORTAL_COMMAND::CONNECT))
+  {
+    _isStagingBusy = false;
+    request->send(503, "text/plain", "Busy, try again");
+    return;
+  }
 
+  ESP_LOGV(APP,"Connection to %s requested\n", _stagedSsid);
 
-  _wifiStatus = WIFI_STATUS::READY_TO_CONNECT; //Value is checked on loop();
-  return;
+  //Client sends it back on /wifi-status to read the result of this attempt only
+  char session[9];
+  snprintf(session, sizeof(session), "%08" PRIx32, _stagedSession);
+  AsyncWebServerResponse *response = request->beginResponse(200, "text/plain", "Data received, trying to connect to Wi-Fi...");
+  response->addHeader("X-Session", session);
+  request->send(response);
 }
 
 void EasyWifi::checkWiFiStatusController(AsyncWebServerRequest *request)
 {
+  uint32_t session = request->hasParam("session") ? strtoul(request->getParam("session")->value().c_str(), nullptr, 16) : 0;
+
+  bool isStaged = _isStagingBusy; //Submitted, update() didn't pick it up yet
+  if(session != 0 && session != (isStaged ? _stagedSession : _connectSession.load()))
+  {
+    request->send(410, "text/plain", "Another connection was requested after yours");
+    return;
+  }
+
+  if(isStaged)
+  {
+    request->send(202, "text/plain", "Trying Connection...");
+    return;
+  }
+
   switch(_wifiStatus)
   {
+    case WIFI_STATUS::READY_TO_CONNECT:
     case WIFI_STATUS::CONNECTING:
       request->send(202, "text/plain", "Trying Connection...");
     break;
@@ -155,7 +405,12 @@ void EasyWifi::checkWiFiStatusController(AsyncWebServerRequest *request)
 
     case WIFI_STATUS::ERROR:
       request->send(500, "text/plain", "Error connecting to Wi-Fi");
-      _wifiStatus = WIFI_STATUS::IDLE; //Reset status
+      if(session == 0) //Clients without a session reset it, the others keep reading their own result
+        _commands.push(PORTAL_COMMAND::CLEAR_ERROR);
+    break;
+
+    default:
+      request->send(400, "text/plain", "No connection requested");
     break;
   }
 }
@@ -163,94 +418,312 @@ void EasyWifi::checkWiFiStatusController(AsyncWebServerRequest *request)
 /*
 *   Captive portal is set to a different route depending of the dispositive,
 *   so I used the onNotFound method to redirect to my Ip route instead.
-*   I didn't use asyncWebServer captive portal example just to simplify the amount of code, but it does the same thing
+*   OS probes and other hosts get a redirect to the prebuilt portal url, nothing is formatted per request.
 */
 void EasyWifi::redirectToIpController(AsyncWebServerRequest *request)
 {
-  String apIPString = "http://" + WiFi.softAPIP().toString();
+  bool isProbe = isCaptiveProbe(request->url().c_str());
+  countRequest(isProbe ? ROUTE::CAPTIVE_PROBE : ROUTE::REDIRECT);
 
-  if ( !(request->host().equals(apIPString)) ) //Check if user isn't at Ip url
-    request->redirect(apIPString);
+  if(isProbe || request->host() != _portalHost)
+  {
+    request->redirect(_portalUrl);
+    return;
+  }
+
+  //Already at the portal address, an unknown path shows the portal instead of redirecting to itself
+  if(!staticAssetController(request, "/"))
+    request->send(404, "text/plain", "Not found");
 }
 
+//Files are looked up by staticAssetController(), here we only check the file system
 void EasyWifi::serveStaticRoutes()
 {
 #ifdef EASYWIFI_LITTLEFS
-  if(!LittleFS.begin() && LittleFS.open("/easyWifi", "r")){
+  _isFileSystemMounted = LittleFS.begin() && LittleFS.exists(LITTLEFS_ROOT);
+
+  if(!_isFileSystemMounted)
     ESP_LOGE(APP,"LittleFS Failed, please check if the /data/easyWifi folder exists");
-    return;
+#endif  
+}
+
+#ifdef EASYWIFI_LITTLEFS
+static const char* mimeTypeOf(const char *path)
+{
+  const char *extension = strrchr(path, '.');
+  for(const AssetType &type : ASSET_TYPES)
+    if(extension != nullptr && strcmp(extension, type.extension) == 0)
+      return type.mimeType;
+  return "application/octet-stream";
+}
+#endif
+
+/// @return True if the url is a frontend file and it was answered
+bool EasyWifi::staticAssetController(AsyncWebServerRequest *request, const char *url)
+{
+#ifdef EASYWIFI_LITTLEFS
+  if(!_isFileSystemMounted || strstr(url, "..") != nullptr)
+    return false;
+
+  char path[FILE_CACHE_PATH_LENGTH];
+  snprintf(path, sizeof(path), "%s%s", LITTLEFS_ROOT, strcmp(url, "/") == 0 ? "/index.htm" : url);
+  const char *mimeType = mimeTypeOf(path);
+
+  const CachedFile *file = _fileCache.get(LittleFS, path);
+  if(file)
+  {
+    sendCachedFile(request, *file, mimeType);
+    return true;
   }
 
-  // All static routes are served from /easyWifi folder
-  _server->serveStatic("/", LittleFS , "/easyWifi")
-        .setDefaultFile("index.htm");
+  //Not cacheable, stream it from flash
+  return sendFlashFile(request, path, mimeType);
 #else
-  _server->on("/", HTTP_GET, [](AsyncWebServerRequest *request){
-    AsyncWebServerResponse *response = request->beginResponse_P(
-      200, "text/html",index_htm_gz,index_htm_gz_len);
+  for(const StaticAsset &asset : FRONTEND_ASSETS)
+  {
+    if(strcmp(url, asset.path) == 0)
+    {
+      sendStaticAsset(request, asset);
+      return true;
+    }
+  }
+  return false;
+#endif
+}
 
-    response->addHeader("Content-Encoding", "gzip");
-    request->send(response);
-  });
+/// @return True if the browser copy is still valid and a bodiless 304 was sent
+//Weak comparison, as If-None-Match asks: W/ is ignored on both sides and the quoted tags must be equal.
+//"*" matches any tag, entries that aren't quoted are skipped
+static bool isEtagListed(const char *list, const char *etag)
+{
+  if(strncmp(etag, "W/", 2) == 0)
+    etag += 2;
+  size_t etagLength = strlen(etag);
 
-  _server->on("/style.css", HTTP_GET, [](AsyncWebServerRequest *request){
-    AsyncWebServerResponse *response = request->beginResponse_P(
-      200, "text/css", style_css_gz,style_css_gz_len);
+  const char *cursor = list;
+  while(*cursor != '\0')
+  {
+    cursor += strspn(cursor, " \t,");
+    if(*cursor == '*' && (cursor[1] == '\0' || strchr(" \t,", cursor[1]) != nullptr))
+      return true;
+    if(strncmp(cursor, "W/", 2) == 0)
+      cursor += 2;
+
+    const char *end = *cursor == '"' ? strchr(cursor + 1, '"') : nullptr;
+    if(end == nullptr)
+    {
+      cursor += strcspn(cursor, ","); //Not a tag, on to the next entry
+      continue;
+    }
+    size_t length = end + 1 - cursor;
+    if(length == etagLength && memcmp(cursor, etag, length) == 0)
+      return true;
+    cursor = end + 1;
+  }
+  return false;
+}
 
-    response->addHeader("Content-Encoding", "gzip");
-    request->send(response);
-  });
+static bool isEtagListed(AsyncWebServerRequest *request, const char *etag)
+{
+  return request->hasHeader("If-None-Match") && isEtagListed(request->header("If-None-Match").c_str(), etag);
+}
+
+bool EasyWifi::sendNotModified(AsyncWebServerRequest *request, const char *etag, const char *lastModified)
+{
+  bool isFresh = request->hasHeader("If-None-Match") ? 
+    isEtagListed(request, etag) :
+    lastModified != nullptr && request->hasHeader("If-Modified-Since") && request->header("If-Modified-Since") == lastModified;
+
+  if(!isFresh)
+    return false;
+
+  AsyncWebServerResponse *response = request->beginResponse(304);
+  response->addHeader("ETag", etag);
+  request->send(response);
+  return true;
+}
+
+void EasyWifi::sendStaticAsset(AsyncWebServerRequest *request, const StaticAsset &asset)
+{
+  if(sendNotModified(request, asset.etag))
+    return;
+
+  AsyncWebServerResponse *response = request->beginResponse_P(200, asset.mimeType, asset.data, asset.length);
+  response->addHeader("Content-Encoding", "gzip");
+  response->addHeader("ETag", asset.etag);
+  response->addHeader("Cache-Control", "no-cache"); //Always revalidate, a 304 costs almost nothing
+  request->send(response);
+}
+
+#ifdef EASYWIFI_LITTLEFS
+//Empty if the file system has no write time for it
+static void formatHttpDate(time_t date, char *out, size_t outLen)
+{
+  out[0] = '\0';
+  if(date == 0)
+    return;
+
+  struct tm time;
+  gmtime_r(&date, &time);
+  strftime(out, outLen, "%a, %d %b %Y %H:%M:%S GMT", &time);
+}
+
+void EasyWifi::sendCachedFile(AsyncWebServerRequest *request, const CachedFile &file, const char *mimeType)
+{
+  char lastModified[32];
+  formatHttpDate(file.lastWrite, lastModified, sizeof(lastModified));
+
+  if(sendNotModified(request, file.etag, lastModified[0] ? lastModified : nullptr))
+    return;
 
-  _server->on("/script.js", HTTP_GET, [](AsyncWebServerRequest *request){
-    AsyncWebServerResponse *response = request->beginResponse_P(
-      200, "text/javascript", script_js_gz,script_js_gz_len);
-      
+  //Response keeps its own reference, the file can be evicted while it is still sending
+  std::shared_ptr<uint8_t> data = file.data;
+  size_t length = file.length;
+
+  AsyncWebServerResponse *response = request->beginResponse(mimeType, length,
+    [data, length](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+      size_t chunk = length - index < maxLen ? length - index : maxLen;
+      memcpy(buffer, data.get() + index, chunk);
+      return chunk;
+    });
+
+  if(file.isGzip)
     response->addHeader("Content-Encoding", "gzip");
-    request->send(response);
-  });  
-#endif  
+  if(lastModified[0])
+    response->addHeader("Last-Modified", lastModified);
+  response->addHeader("ETag", file.etag);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
 }
 
-String EasyWifi::sendJsonNetworks()
+//Validators come from the size and write time of the file, so it is never read just to answer a 304.
+//Headers and body come from the same opened file, the .gz sibling when there is one like the cache
+bool EasyWifi::sendFlashFile(AsyncWebServerRequest *request, const char *path, const char *mimeType)
 {
-  //JSON START - I didn't use ArduinoJson to reduce memory usage
-  String json;
-  json.reserve(100 * _avaibleNetworks); //average size of json structure(100 bytes) * number of networks
+  char gzipPath[FILE_CACHE_PATH_LENGTH + 3];
+  snprintf(gzipPath, sizeof(gzipPath), "%s.gz", path);
 
-  json += "[";
-    for (int i = 0; i < _avaibleNetworks; i++)
-    {
-      if (i) json += ","; // Comma if not the first element
-      json += "{";
-      json += "\"ssid\":\"" + WiFi.SSID(i) + "\"";
-      json += ",\"rssi\":" + String(WiFi.RSSI(i));
-      json += ",\"isProtected\":" + String(WiFi.encryptionType(i) != WIFI_AUTH_OPEN);
-      json += "}";
-    }
-  json += "]"; //Finished JSON
+  const char *sourcePath = LittleFS.exists(gzipPath) ? gzipPath : LittleFS.exists(path) ? path : nullptr;
+  if(sourcePath == nullptr)
+    return false;
+
+  File source = LittleFS.open(sourcePath, "r");
+  if(!source || source.isDirectory())
+    return false;
+
+  char etag[24];
+  char lastModified[32];
+  snprintf(etag, sizeof(etag), "W/\"%08x-%08x\"", (unsigned int)source.size(), (unsigned int)source.getLastWrite());
+  formatHttpDate(source.getLastWrite(), lastModified, sizeof(lastModified));
+
+  if(sendNotModified(request, etag, lastModified[0] ? lastModified : nullptr))
+  {
+    source.close();
+    return true;
+  }
+
+  //A .gz file served under its plain path gets Content-Encoding: gzip from the response itself
+  AsyncWebServerResponse *response = request->beginResponse(source, path, mimeType);
+  if(lastModified[0])
+    response->addHeader("Last-Modified", lastModified);
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+  return true;
+}
+#endif
 
-  return json;
+//A rescan never empties the list, clients get the last results with the 202 until the new ones are in
+void EasyWifi::sendScanPending(AsyncWebServerRequest *request, const ScanSnapshotRef &scan, const char *message)
+{
+  if(scan->generation == 0) //Nothing scanned yet
+  {
+    request->send(202, "text/plain", message);
+    return;
+  }
+  sendJsonNetworks(request, scan, true);
+}
+
+//JSON is streamed in chunks from a fixed buffer - I didn't use ArduinoJson to reduce memory usage
+///@param isPending A scan is due or running, answers 202 so the client keeps polling
+void EasyWifi::sendJsonNetworks(AsyncWebServerRequest *request, const ScanSnapshotRef &scan, bool isPending)
+{
+  int code = isPending ? 202 : 200;
+
+  char etag[12];
+  char generation[11];
+  snprintf(etag, sizeof(etag), "\"%08" PRIx32 "\"", scan->hash);
+  snprintf(generation, sizeof(generation), "%" PRIu32, scan->generation);
+
+  //Client generation, 0 if it has none
+  uint32_t since = request->hasParam("since") ? strtoul(request->getParam("since")->value().c_str(), nullptr, 10) : 0;
+
+  AsyncWebServerResponse *response = nullptr;
+  bool isDelta = false;
+  bool isFresh = (since != 0 && since == scan->generation) ||
+    isEtagListed(request, etag);
+
+  if(isFresh) //Same scan or same content, nothing to send
+    response = isPending ? request->beginResponse(202, "text/plain", "Scanning...") : request->beginResponse(304);
+
+  else if(since != 0 && since + 1 == scan->generation)
+  {
+    ScanSnapshotRef previous = readPreviousScan(since); //Held only while the delta is written
+    char delta[EVENT_JSON_MAX_LENGTH];
+    size_t length = previous ? ScanJsonWriter::writeDelta(scan->table, previous->table, delta, sizeof(delta)) : 0;
+    isDelta = length != 0; //Too big or no longer kept, full list below
+    if(isDelta)
+      response = request->beginResponse(code, "application/json", delta);
+  }
+
+  if(!response)
+  {
+    ScanJsonWriter writer(scan->table);
+    response = request->beginChunkedResponse("application/json", //Capturing scan keeps the table alive until the last chunk
+      [scan, writer](uint8_t *buffer, size_t maxLen, size_t) mutable -> size_t { //Slot held until the response is deleted
+        return writer.write(buffer, maxLen);
+      });
+    response->setCode(code);
+  }
+
+  if(!isDelta) //A delta is not the representation the ETag stands for
+    response->addHeader("ETag", etag);
+  response->addHeader("X-Scan-Generation", generation);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
 }
 
 void EasyWifi::logoutCaptivePortal()
 {
+  StateLock lock(_stateMutex);
   _isCaptivePortalEnabled = false;
+  _isLogoutPending = false;
+  _trace.record(TRACE_EVENT::PORTAL_STOP, (uint8_t)_wifiStatus.load());
 
   if(_server)
     _server->end();
   
   if(_dnsServer)
     _dnsServer->stop();
-  
-  delay(2000); //Wait for server to end, dns to process last requests and user be able to see the connected message
 
   freePointers();
+
+  PORTAL_COMMAND command;
+  while(_commands.pop(command)); //Requests to the closed portal are dropped
+  _isStagingBusy = false;
+
   WiFi.mode(WIFI_STA); //Back to station mode
   ESP_LOGI(APP,"Captive Portal ended\n");
+
+  if(_wifiStatus != WIFI_STATUS::CONNECTED && _credentials.count() > 0) //Timed out, go back to retrying what we know
+    _reconnect.schedule(millis());
 }
 
 void EasyWifi::freePointers()
 {
+#ifndef EASYWIFI_STATIC_ARENA //Arena objects are only stopped by logoutCaptivePortal(), the next start reuses them
+  _events = nullptr; //Deleted by the server
+
   if(_dnsServer)
   {
     delete _dnsServer;
@@ -262,6 +735,7 @@ void EasyWifi::freePointers()
     delete _server;
     _server = nullptr;
   }
+#endif
 }
 
 void EasyWifi::checkCaptivePortalTimeout()
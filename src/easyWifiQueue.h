@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+namespace EASYWIFI{
+
+/*
+*   Lock-free ring for exactly one producer task and one consumer task.
+*   Each side only writes its own index, the release/acquire pair makes the item
+*   visible before the index that publishes it. Holds SIZE - 1 items.
+*/
+template<typename T, uint8_t SIZE>
+class SpscQueue
+{
+  public:
+    ///@return False if full, the item is dropped
+    bool push(const T &item)
+    {
+      uint8_t head = _head.load(std::memory_order_relaxed);
+      uint8_t next = (head + 1) % SIZE;
+      if(next == _tail.load(std::memory_order_acquire))
+        return false;
+
+      _items[head] = item;
+      _head.store(next, std::memory_order_release);
+      return true;
+    };
+
+    ///@return False if empty
+    bool pop(T &item)
+    {
+      uint8_t tail = _tail.load(std::memory_order_relaxed);
+      if(tail == _head.load(std::memory_order_acquire))
+        return false;
+
+      item = _items[tail];
+      _tail.store((tail + 1) % SIZE, std::memory_order_release);
+      return true;
+    };
+
+  private:
+    T _items[SIZE];
+    std::atomic<uint8_t> _head{0};
+    std::atomic<uint8_t> _tail{0};
+};
+
+};
@@ -0,0 +1,34 @@
+//easyWifiReconnect.cpp
+
+#include "easyWifiReconnect.h"
+
+using namespace EASYWIFI;
+
+uint32_t ReconnectScheduler::schedule(unsigned long now)
+{
+  uint32_t backoff = _base;
+  for(uint8_t i = 0; i < _failures && backoff < _max; i++)
+    backoff = backoff > _max / 2 ? _max : backoff * 2;
+  if(backoff > _max)
+    backoff = _max;
+
+  uint32_t delay = backoff / 2 + nextRandom() % (backoff / 2 + 1);
+
+  if(_failures < UINT8_MAX)
+    _failures++;
+  _nextAttempt = now + delay;
+  _isScheduled = true;
+  return delay;
+}
+
+uint32_t ReconnectScheduler::nextRandom()
+{
+  if(_random == 0)
+    _random = 1;
+
+  //xorshift32, plenty to spread devices apart and cheap to reproduce on a host
+  _random ^= _random << 13;
+  _random ^= _random >> 17;
+  _random ^= _random << 5;
+  return _random;
+}
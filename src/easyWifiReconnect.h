@@ -0,0 +1,52 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define RECONNECT_BACKOFF_BASE 2000   //ms before the first retry, doubled after every failed round
+#define RECONNECT_BACKOFF_MAX  120000 //Backoff stops growing here
+
+//Failed rounds in a row before the portal opens, 0 keeps retrying forever
+#define RECONNECT_NOT_FOUND_PORTAL_AFTER 5 //AP down or out of range, usually comes back by itself
+#define RECONNECT_AUTH_PORTAL_AFTER      2 //Wrong password won't fix itself, but a rebooting AP may reject a few handshakes
+
+namespace EASYWIFI{
+
+enum class CONNECT_FAILURE{
+  NOT_FOUND,   //No AP answered or attempt timed out
+  AUTH_FAILED, //AP found but rejected the credentials
+};
+
+/*
+*   Decides when the stored networks are tried again after every one of them failed.
+*   Delays grow exponentially with equal jitter (half fixed, half random), so devices
+*   that lost the same AP don't all retry in the same instant. Time is always passed
+*   in and the PRNG is seedable, so the timeline is fully deterministic for a given seed.
+*/
+class ReconnectScheduler
+{
+  public:
+    void seed(uint32_t seed) { _random = seed ? seed : 1; }; //xorshift never leaves 0
+    bool isSeeded() const { return _random != 0; };
+    void set_Backoff(uint32_t base, uint32_t max) { _base = base; _max = max; };
+
+    ///@return Delay in ms until the next round, counted as one more failure
+    uint32_t schedule(unsigned long now);
+    bool isDue(unsigned long now) const { return _isScheduled && (long)(now - _nextAttempt) >= 0; };
+    void cancel() { _isScheduled = false; };
+    void reset() { _failures = 0; _isScheduled = false; }; //After a successful connection
+
+    uint8_t get_failures() const { return _failures; };
+    bool get_isScheduled() const { return _isScheduled; };
+
+  private:
+    uint32_t nextRandom();
+
+    uint32_t _random = 0;
+    uint32_t _base = RECONNECT_BACKOFF_BASE;
+    uint32_t _max = RECONNECT_BACKOFF_MAX;
+    unsigned long _nextAttempt = 0;
+    uint8_t _failures = 0;
+    bool _isScheduled = false;
+};
+
+};
@@ -0,0 +1,26 @@
+//easyWifiRoaming.cpp
+
+#include "easyWifiRoaming.h"
+
+using namespace EASYWIFI;
+
+void RoamingPolicy::sample(int8_t rssi)
+{
+  int16_t scaled = rssi * 16;
+
+  if(_samples == 0) //First sample of the link starts the average right there
+    _average = scaled;
+  else
+    _average += (scaled - _average) / ROAMING_EWMA_WEIGHT;
+
+  if(_samples < UINT16_MAX)
+    _samples++;
+}
+
+bool RoamingPolicy::isScanDue(unsigned long now) const
+{
+  if(_samples < ROAMING_MIN_SAMPLES || get_averageRssi() >= _threshold)
+    return false;
+
+  return !_hasScanned || now - _lastScan >= _interval;
+}
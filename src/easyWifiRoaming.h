@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define ROAMING_SAMPLE_INTERVAL 1000  //ms between RSSI samples of the connected AP
+#define ROAMING_MIN_SAMPLES     5     //Samples before the average is trusted, a single dip never scans
+#define ROAMING_EWMA_WEIGHT     4     //Each sample moves the average by 1/4 of its difference
+#define ROAMING_RSSI_THRESHOLD  -75   //dBm, a weaker average starts looking for a better AP
+#define ROAMING_HYSTERESIS      8     //dB a new AP must beat the current average by
+#define ROAMING_SCAN_INTERVAL   60000 //Min ms between roaming scans, also counted from the last roam
+
+namespace EASYWIFI{
+
+/*
+*   Decides when to look for a better AP of the connected network and whether a found one is worth moving to.
+*   RSSI is smoothed with an EWMA in 1/16 dBm steps, so short dips don't trigger scans. Scans are rate limited
+*   and a candidate has to beat the current link by the hysteresis, so two similar APs never ping-pong.
+*   Time and RSSI are always passed in, so scripted RSSI traces replay the same decisions on a host.
+*/
+class RoamingPolicy
+{
+  public:
+    ///@param threshold Average RSSI in dBm below which a scan is started
+    ///@param hysteresis dB a candidate must be stronger than the average
+    ///@param interval Min ms between scans
+    void set_Policy(int8_t threshold, uint8_t hysteresis, uint32_t interval) { _threshold = threshold; _hysteresis = hysteresis; _interval = interval; };
+
+    void sample(int8_t rssi);
+    bool isScanDue(unsigned long now) const;
+    void scanStarted(unsigned long now) { _lastScan = now; _hasScanned = true; }; //Also called on roam, holds the next scan back
+    bool isBetter(int8_t candidateRssi) const { return _samples > 0 && candidateRssi >= get_averageRssi() + _hysteresis; };
+    void restart() { _samples = 0; }; //New link, old samples don't describe it
+
+    int8_t get_averageRssi() const { return _average / 16; };
+    uint16_t get_samples() const { return _samples; };
+
+  private:
+    int16_t _average = 0; //1/16 dBm
+    uint16_t _samples = 0;
+    int8_t _threshold = ROAMING_RSSI_THRESHOLD;
+    uint8_t _hysteresis = ROAMING_HYSTERESIS;
+    uint32_t _interval = ROAMING_SCAN_INTERVAL;
+    unsigned long _lastScan = 0;
+    bool _hasScanned = false;
+};
+
+};
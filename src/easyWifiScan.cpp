@@ -0,0 +1,94 @@
+//easyWifiScan.cpp
+
+#include "easyWifiScan.h"
+
+using namespace EASYWIFI;
+
+int8_t ScanTable::find(const char *ssid) const
+{
+  return findHash(ssid, hashString(ssid));
+}
+
+int8_t ScanTable::findHash(const char *ssid, uint32_t hash) const
+{
+  for(uint8_t i = 0; i < _count; i++)
+    if(_entries[i].ssidHash == hash && strcmp(_entries[i].ssid, ssid) == 0)
+      return i;
+  return -1;
+}
+
+uint32_t ScanTable::contentHash() const
+{
+  uint32_t hash = HASH_SEED;
+  for(uint8_t i = 0; i < _count; i++)
+  {
+    const ScanEntry &entry = _entries[i];
+    hash = hashBytes(&entry.ssidHash, sizeof(entry.ssidHash), hash);
+    hash = hashBytes(&entry.rssi, sizeof(entry.rssi), hash);
+    hash = hashBytes(&entry.isProtected, sizeof(entry.isProtected), hash);
+    hash = hashBytes(&entry.apCount, sizeof(entry.apCount), hash);
+  }
+  return hash;
+}
+
+bool ScanTable::add(const char *ssid, int8_t rssi, const uint8_t *bssid, uint8_t channel, bool isProtected)
+{
+  if(ssid[0] == '\0') //Hidden network, nothing to show or match
+    return false;
+
+  uint32_t hash = hashString(ssid);
+  int8_t index = findHash(ssid, hash);
+
+  if(index >= 0) //Another AP of a known SSID, only the strongest one is kept
+  {
+    ScanEntry &entry = _entries[index];
+    if(entry.apCount < UINT8_MAX)
+      entry.apCount++;
+
+    if(rssi > entry.rssi)
+    {
+      entry.rssi = rssi;
+      entry.channel = channel;
+      entry.isProtected = isProtected;
+      memcpy(entry.bssid, bssid, sizeof(entry.bssid));
+    }
+    return true;
+  }
+
+  if(_count < SCAN_MAX_ENTRIES)
+    index = _count++;
+  else //Full, replace the weakest network if this one is stronger
+  {
+    index = 0;
+    for(uint8_t i = 1; i < _count; i++)
+      if(_entries[i].rssi < _entries[index].rssi)
+        index = i;
+
+    if(rssi <= _entries[index].rssi)
+      return false;
+  }
+
+  ScanEntry &entry = _entries[index];
+  strncpy(entry.ssid, ssid, SSID_MAX_LENGTH);
+  entry.ssid[SSID_MAX_LENGTH] = '\0';
+  entry.rssi = rssi;
+  entry.channel = channel;
+  entry.apCount = 1;
+  entry.isProtected = isProtected;
+  memcpy(entry.bssid, bssid, sizeof(entry.bssid));
+  entry.ssidHash = hash;
+  return true;
+}
+
+void ScanTable::sort()
+{
+  //Insertion sort, the table is small and the driver already returns it almost sorted
+  for(uint8_t i = 1; i < _count; i++)
+  {
+    ScanEntry entry = _entries[i];
+    uint8_t j = i;
+    for(; j > 0 && _entries[j - 1].rssi < entry.rssi; j--)
+      _entries[j] = _entries[j - 1];
+    _entries[j] = entry;
+  }
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <Arduino.h>
+#include "easyWifiCredentials.h" //SSID_MAX_LENGTH
+#include "easyWifiHash.h"
+
+#ifndef SCAN_MAX_ENTRIES
+  #define SCAN_MAX_ENTRIES 32 //Distinct SSIDs kept from a scan, the weakest ones are dropped when full
+#endif
+
+#define SCAN_CHANNELS_MAX 14 //2.4 GHz channels
+
+namespace EASYWIFI{
+
+//One step of SCAN_PROFILE::CHANNELS
+struct ScanChannel
+{
+  uint8_t channel;
+  bool isPassive; //Listen for beacons instead of probing
+  uint16_t dwell; //ms on the channel
+};
+
+//One SSID, however many APs broadcast it
+struct ScanEntry
+{
+  char ssid[SSID_MAX_LENGTH + 1];
+  int8_t rssi;        //Strongest AP
+  uint8_t channel;    //Channel and BSSID of the strongest AP
+  uint8_t apCount;    //APs seen with this SSID, >1 on mesh networks
+  bool isProtected;
+  uint8_t bssid[6];
+  uint32_t ssidHash;
+};
+
+/*
+*   Scan results copied out of the WiFi driver, one entry per SSID sorted by RSSI.
+*   Filled once per scan so the driver buffer can be freed right away, every
+*   response and the stored networks matching read from here afterwards.
+*/
+class ScanTable
+{
+  public:
+    uint8_t count() const { return _count; };
+    const ScanEntry& get(uint8_t index) const { return _entries[index]; };
+    ///@return Index of the SSID, -1 if it was not seen
+    int8_t find(const char *ssid) const;
+    ///@return Hash of every entry, equal for two scans that would render the same JSON
+    uint32_t contentHash() const;
+
+    void clear() { _count = 0; };
+    ///@return False if the AP was dropped, hidden SSID or table full of stronger networks
+    bool add(const char *ssid, int8_t rssi, const uint8_t *bssid, uint8_t channel, bool isProtected);
+    void sort(); //Strongest first, call once every AP was added
+
+  private:
+    int8_t findHash(const char *ssid, uint32_t hash) const;
+
+    ScanEntry _entries[SCAN_MAX_ENTRIES];
+    uint8_t _count = 0;
+};
+
+};
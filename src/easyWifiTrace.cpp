@@ -0,0 +1,74 @@
+//easyWifiTrace.cpp
+
+#include "easyWifiTrace.h"
+
+using namespace EASYWIFI;
+
+#ifdef EASYWIFI_NO_TRACE
+
+size_t TraceBuffer::dump([[maybe_unused]] Print &out, [[maybe_unused]] bool isHex) const
+{
+  return 0; //Nothing recorded
+}
+
+#else
+
+#define TRACE_HEX_BEGIN "--- easyWifi trace ---"
+#define TRACE_HEX_END   "--- end of trace ---"
+#define TRACE_HEX_LINE  32 //Bytes per line of a hex dump
+
+//Writes raw bytes, or their hex with a line break every TRACE_HEX_LINE bytes
+static size_t writeBytes(Print &out, const void *data, size_t length, bool isHex, size_t &column)
+{
+  if(!isHex)
+    return out.write(static_cast<const uint8_t*>(data), length);
+
+  static const char digits[] = "0123456789abcdef";
+  const uint8_t *bytes = static_cast<const uint8_t*>(data);
+  size_t written = 0;
+  for(size_t i = 0; i < length; i++)
+  {
+    char pair[3] = { digits[bytes[i] >> 4], digits[bytes[i] & 0x0F], '\n' };
+    bool isLineEnd = ++column % TRACE_HEX_LINE == 0;
+    written += out.write(reinterpret_cast<const uint8_t*>(pair), isLineEnd ? 3 : 2);
+  }
+  return written;
+}
+
+size_t TraceBuffer::dump(Print &out, bool isHex) const
+{
+  uint32_t recorded = _next.load(std::memory_order_acquire);
+  uint32_t count = recorded < TRACE_BUFFER_SIZE ? recorded : TRACE_BUFFER_SIZE;
+
+  TraceDumpHeader header;
+  header.magic = TRACE_DUMP_MAGIC;
+  header.version = TRACE_DUMP_VERSION;
+  header.recordSize = sizeof(TraceRecord);
+  header.count = count;
+  header.recorded = recorded;
+  header.now = micros();
+
+  size_t written = 0;
+  size_t column = 0;
+  if(isHex)
+    written += out.println(TRACE_HEX_BEGIN);
+
+  written += writeBytes(out, &header, sizeof(header), isHex, column);
+
+  //Oldest first, each one is copied out so a writer can only tear the record being copied
+  for(uint32_t index = recorded - count; index != recorded; index++)
+  {
+    TraceRecord record = _records[index & (TRACE_BUFFER_SIZE - 1)];
+    written += writeBytes(out, &record, sizeof(record), isHex, column);
+  }
+
+  if(isHex)
+  {
+    if(column % TRACE_HEX_LINE != 0)
+      written += out.println();
+    written += out.println(TRACE_HEX_END);
+  }
+  return written;
+}
+
+#endif
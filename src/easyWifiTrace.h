@@ -0,0 +1,97 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+#ifndef TRACE_BUFFER_SIZE
+  #define TRACE_BUFFER_SIZE 128 //Records kept, oldest ones are overwritten. Power of two, 12 bytes each
+#endif
+
+#define TRACE_DUMP_MAGIC   0x52545745 //"EWTR" in the first 4 bytes of a dump
+#define TRACE_DUMP_VERSION 1
+
+namespace EASYWIFI{
+
+//Event ids of the trace, decode_trace.py reads the names from here so new ones go at the end.
+//Arguments never hold passwords, networks are only identified by hashString() of the SSID
+enum class TRACE_EVENT : uint8_t {
+  BOOT,             //setup() called
+  WIFI_STATE,       //arg8 WIFI_STATUS
+  SCAN_STATE,       //arg8 SCAN_STATUS
+  SCAN_START,       //arg8 SCAN_PROFILE, arg16 steps
+  SCAN_STEP,        //arg8 step, arg16 channel (0 = all)
+  SCAN_DONE,        //arg8 networks found, arg32 generation
+  SCAN_FAILED,      //arg8 0 = not started, 1 = driver failed, 2 = timed out
+  CONNECT_START,    //arg8 fast connect, arg16 channel, arg32 SSID hash
+  CONNECT_DONE,     //arg32 duration in ms
+  CONNECT_FAILED,   //arg8 wl_status_t, arg32 SSID hash
+  RECONNECT,        //arg8 failed rounds, arg16 CONNECT_FAILURE, arg32 delay in ms, 0 if the portal opened instead
+  PORTAL_START,
+  PORTAL_STOP,      //arg8 WIFI_STATUS when it closed
+  REQUEST,          //arg8 ROUTE
+  COMMAND,          //arg8 PORTAL_COMMAND applied by update()
+  NVS_READ,         //arg8 networks read
+  NVS_WRITE,        //arg8 networks, arg16 record size, arg32 1 if saved
+  NVS_WRITE_SKIPPED,
+  ROAM_SCAN,        //arg8 average RSSI (int8)
+  ROAM,             //arg8 average RSSI (int8), arg16 new channel, arg32 new AP RSSI (int8)
+};
+
+struct TraceRecord
+{
+  uint32_t time;  //micros(), wraps every ~71 minutes
+  uint8_t event;  //TRACE_EVENT
+  uint8_t arg8;
+  uint16_t arg16;
+  uint32_t arg32;
+};
+
+//Precedes the records on every dump, all fields little endian as they are in RAM
+struct TraceDumpHeader
+{
+  uint32_t magic;
+  uint8_t version;
+  uint8_t recordSize;
+  uint16_t count;    //Records that follow, oldest first
+  uint32_t recorded; //Records since boot, more than count if some were overwritten
+  uint32_t now;      //micros() when dumped
+};
+
+/*
+*   Fixed ring of binary trace records, cheap enough to stay on in production.
+*   Writers only claim a slot with an atomic increment, so update() and the web server
+*   task record without locks. A record written while a dump reads it may come out torn,
+*   the decoder flags it by its out of order time.
+*/
+class TraceBuffer
+{
+  static_assert((TRACE_BUFFER_SIZE & (TRACE_BUFFER_SIZE - 1)) == 0, "TRACE_BUFFER_SIZE must be a power of two");
+
+  public:
+    void record([[maybe_unused]] TRACE_EVENT event, [[maybe_unused]] uint8_t arg8 = 0, [[maybe_unused]] uint16_t arg16 = 0, [[maybe_unused]] uint32_t arg32 = 0)
+    {
+#ifndef EASYWIFI_NO_TRACE //Calls stay in place and compile to nothing
+      uint32_t index = _next.fetch_add(1, std::memory_order_relaxed);
+      TraceRecord &slot = _records[index & (TRACE_BUFFER_SIZE - 1)];
+      slot.time = micros();
+      slot.event = (uint8_t)event;
+      slot.arg8 = arg8;
+      slot.arg16 = arg16;
+      slot.arg32 = arg32;
+#endif
+    };
+
+    ///@param isHex Hex text between marker lines, survives a serial monitor. Raw bytes otherwise
+    ///@return Bytes written to out
+    size_t dump(Print &out, bool isHex = false) const;
+
+    uint32_t get_recorded() const { return _next.load(std::memory_order_relaxed); };
+
+  private:
+#ifndef EASYWIFI_NO_TRACE
+    TraceRecord _records[TRACE_BUFFER_SIZE] = {};
+#endif
+    std::atomic<uint32_t> _next{0};
+};
+
+};
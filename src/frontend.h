@@ -1,11 +1,21 @@
+//Generated by gen_frontend_header.py, do not edit
+#pragma once
+
 #include <pgmspace.h> //for PROGMEM
+#include "easyWifi.h" //for StaticAsset
+
+namespace EASYWIFI{
+
+static const uint8_t index_htm_gz[] PROGMEM = { 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x7d, 0x53, 0x4d, 0x6f, 0xdb, 0x30, 0x0c, 0xbd, 0xf7, 0x57, 0x68, 0xba, 0x76, 0x6a, 0xb0, 0x7b, 0xec, 0x4b, 0xd7, 0x1d, 0xb7, 0x02, 0x1d, 0x50, 0xf4, 0xa8, 0xc8, 0x4c, 0xcc, 0x55, 0x96, 0x0c, 0x89, 0x4e, 0x9a, 0x7f, 0x5f, 0xea, 0x23, 0x6e, 0x9c, 0x04, 0xbb, 0x98, 0xe2, 0x13, 0x1f, 0xfd, 0xf8, 0xa1, 0xf5, 0xb7, 0x9f, 0x7f, 0x1e, 0xff, 0xbe, 0x3d, 0x3f, 0x89, 0x9e, 0x06, 0xdb, 0xde, 0xad, 0x4f, 0x06, 0x74, 0xc7, 0x86, 0x90, 0x2c, 0xb4, 0xaf, 0xf8, 0x0b, 0xc5, 0x0b, 0xd0, 0x34, 0xae, 0x57, 0x05, 0xb9, 0x5b, 0x0f, 0x40, 0x5a, 0x38, 0x3d, 0x40, 0x23, 0xf7, 0x08, 0x87, 0xd1, 0x07, 0x92, 0xc2, 0x78, 0x47, 0xe0, 0xa8, 0x91, 0x07, 0xec, 0xa8, 0x6f, 0x3a, 0xd8, 0xa3, 0x01, 0x95, 0x9d, 0xef, 0x02, 0x1d, 0x12, 0x6a, 0xab, 0xa2, 0xd1, 0x16, 0x9a, 0x1f, 0x92, 0x93, 0x58, 0x74, 0xef, 0x22, 0x80, 0x6d, 0x64, 0xa4, 0xa3, 0x85, 0xd8, 0x03, 0x70, 0x96, 0x3e, 0xc0, 0xb6, 0x22, 0x0f, 0x26, 0xc6, 0x39, 0x10, 0xbb, 0x46, 0x6e, 0x35, 0xa7, 0xf4, 0x4e, 0x16, 0x56, 0x39, 0xd2, 0x71, 0x64, 0x15, 0x38, 0xe8, 0x1d, 0xac, 0xe2, 0x7e, 0x77, 0xff, 0x31, 0xd8, 0xc4, 0x59, 0xd5, 0x1a, 0x36, 0xbe, 0x3b, 0xb2, 0xe9, 0x70, 0x2f, 0x8c, 0xd5, 0x31, 0x36, 0x32, 0xc9, 0xd4, 0xe8, 0x20, 0xc8, 0x25, 0x9e, 0x08, 0x19, 0x7c, 0x01, 0x0b, 0x86, 0x44, 0xae, 0xfb, 0x37, 0xd0, 0xc1, 0x87, 0x77, 0xce, 0xc7, 0x91, 0xcb, 0xf8, 0x03, 0x6e, 0x51, 0x59, 0x8c, 0xac, 0x39, 0x69, 0xfb, 0x72, 0xdb, 0x39, 0x7a, 0x33, 0x11, 0x79, 0x77, 0x22, 0x70, 0xe9, 0x4e, 0x15, 0xa8, 0x50, 0xce, 0x81, 0x44, 0x2a, 0xc7, 0xf6, 0xd6, 0xcf, 0x46, 0xfe, 0xb2, 0x90, 0x4e, 0x0d, 0xbe, 0xd3, 0xb6, 0xd0, 0x2f, 0xb0, 0x25, 0x21, 0x63, 0xaa, 0x8e, 0xe4, 0xe6, 0xdd, 0x5c, 0xef, 0xf5, 0x55, 0x1e, 0xb3, 0x6c, 0x9f, 0x98, 0x1c, 0xc4, 0x73, 0xfd, 0xcd, 0x0d, 0x55, 0x25, 0x3a, 0x4e, 0x9b, 0x42, 0xc8, 0xaa, 0x0a, 0xe6, 0x4a, 0xdf, 0x54, 0xda, 0x11, 0xd9, 0x9e, 0xa8, 0xd5, 0xa0, 0x1b, 0x27, 0xaa, 0x83, 0x23, 0xf8, 0x48, 0xab, 0x73, 0x51, 0x65, 0x8e, 0xb8, 0xa8, 0xb2, 0x62, 0xa3, 0xd5, 0x06, 0x7a, 0x6f, 0x59, 0x7b, 0x23, 0xf3, 0x8c, 0x4e, 0x02, 0x2f, 0x4a, 0x29, 0xdd, 0x54, 0xbb, 0xe0, 0xa7, 0x51, 0x5e, 0x0d, 0xa3, 0x7a, 0x35, 0x88, 0x07, 0x61, 0xa0, 0xb6, 0xb5, 0x9c, 0xe7, 0xb9, 0x3c, 0x66, 0xf7, 0x6c, 0x38, 0xff, 0xcd, 0xe3, 0x9d, 0xe3, 0xdd, 0xa9, 0x89, 0x8a, 0xf3, 0x95, 0xa9, 0xf8, 0xd7, 0x73, 0x5e, 0x9a, 0xb3, 0x12, 0x22, 0x69, 0x9a, 0xa2, 0x1a, 0x20, 0x46, 0x5e, 0xef, 0xba, 0x34, 0x4b, 0x6c, 0xee, 0x6d, 0x34, 0x01, 0x47, 0x12, 0x31, 0x98, 0xb4, 0x58, 0xe9, 0xfc, 0xf0, 0x2f, 0xa6, 0xeb, 0xe2, 0xe4, 0xfd, 0x2a, 0x6f, 0x61, 0x95, 0x5f, 0xf9, 0x27, 0x2b, 0x88, 0x8a, 0xff, 0xfc, 0x03, 0x00, 0x00 };
 
-const uint8_t index_htm_gz[] PROGMEM= { 0x1f, 0x8b, 0x08, 0x08, 0x13, 0x89, 0x91, 0x67, 0x02, 0xff, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x68, 0x74, 0x6d, 0x00, 0x8d, 0x54, 0xc1, 0x6e, 0xdb, 0x30, 0x0c, 0xbd, 0x0f, 0xd8, 0x3f, 0xb0, 0xba, 0x6e, 0x6a, 0xb0, 0xbb, 0xed, 0x4b, 0xd7, 0x1d, 0xb7, 0x02, 0x1b, 0x30, 0xec, 0xa8, 0x58, 0x4c, 0xcc, 0x56, 0x96, 0x0d, 0x89, 0x4e, 0x9a, 0xbf, 0x1f, 0x2d, 0x69, 0x49, 0xec, 0x66, 0xc3, 0x2e, 0xb6, 0x48, 0x91, 0x8f, 0x7c, 0x4f, 0x94, 0xaa, 0xbb, 0xcf, 0xdf, 0x1e, 0x7e, 0xfc, 0x7a, 0x7a, 0x84, 0x8e, 0x7b, 0xd7, 0xbc, 0x7f, 0x57, 0x9d, 0xff, 0x68, 0xac, 0xfc, 0x01, 0x2a, 0x26, 0x76, 0xd8, 0xfc, 0xa4, 0x2f, 0x04, 0xdf, 0x91, 0xa7, 0xb1, 0xda, 0x64, 0x4f, 0xda, 0xec, 0x91, 0x0d, 0x78, 0xd3, 0x63, 0xad, 0x0e, 0x84, 0xc7, 0x71, 0x08, 0xac, 0xa0, 0x1d, 0x3c, 0xa3, 0xe7, 0x5a, 0x1d, 0xc9, 0x72, 0x57, 0x5b, 0x3c, 0x50, 0x8b, 0x3a, 0x19, 0x1f, 0x81, 0x3c, 0x31, 0x19, 0xa7, 0x63, 0x6b, 0x1c, 0xd6, 0x9f, 0x54, 0xc6, 0x71, 0xe4, 0x5f, 0x20, 0xa0, 0xab, 0x55, 0xe4, 0x93, 0xc3, 0xd8, 0x21, 0x0a, 0x50, 0x17, 0x70, 0x57, 0x3c, 0xf7, 0x6d, 0x8c, 0xd7, 0xb1, 0x64, 0x6b, 0xb5, 0x33, 0x02, 0x3c, 0x78, 0x95, 0x13, 0xf3, 0x92, 0x4f, 0xa3, 0xf4, 0x42, 0xbd, 0xd9, 0xe3, 0x26, 0x1e, 0xf6, 0x1f, 0x5e, 0x7b, 0xa7, 0x1a, 0xa8, 0xee, 0xb4, 0x86, 0x12, 0x0e, 0xc6, 0x5a, 0xb4, 0x60, 0x49, 0xda, 0x26, 0x69, 0xc2, 0x9d, 0xa4, 0x27, 0x78, 0x8e, 0x5a, 0xcf, 0xbc, 0x37, 0x85, 0x78, 0xb5, 0x1d, 0xec, 0x29, 0xd7, 0xb3, 0x74, 0x80, 0xd6, 0x99, 0x18, 0x6b, 0x35, 0x33, 0x33, 0xe4, 0x31, 0xe4, 0x56, 0x96, 0x9b, 0x73, 0xe6, 0x65, 0x07, 0x44, 0x2d, 0x87, 0x2d, 0x43, 0x52, 0xee, 0x2b, 0xf2, 0x71, 0x08, 0x2f, 0x25, 0x69, 0x23, 0x59, 0x37, 0x00, 0x8e, 0xb4, 0x23, 0xed, 0x28, 0x0a, 0xf3, 0x99, 0xde, 0xc5, 0x3c, 0x43, 0x26, 0x1e, 0x05, 0x2b, 0xc2, 0x91, 0x9c, 0x83, 0x2d, 0x4a, 0xfb, 0x11, 0x03, 0x0b, 0xa7, 0x0e, 0x03, 0x42, 0xe2, 0xb1, 0x2e, 0x23, 0xd6, 0x76, 0x62, 0x16, 0xf6, 0xa5, 0x96, 0xc8, 0xef, 0x75, 0x76, 0xe5, 0x6a, 0xd7, 0x8e, 0x73, 0x52, 0xa9, 0x98, 0x64, 0x4b, 0xed, 0xec, 0xc8, 0xdb, 0x7f, 0x0a, 0x58, 0xb2, 0x36, 0x19, 0x29, 0x0b, 0x58, 0xfa, 0x58, 0x8b, 0x39, 0xca, 0x57, 0x88, 0x58, 0xdd, 0x0f, 0xd6, 0xb8, 0xdc, 0xc5, 0xca, 0x77, 0x43, 0xa4, 0xb4, 0xa1, 0xcb, 0x88, 0x5d, 0x29, 0xf3, 0x26, 0x64, 0x7d, 0x1c, 0xb7, 0x62, 0xd2, 0x24, 0xab, 0xe6, 0x51, 0xc0, 0x02, 0x3c, 0x95, 0xda, 0x4b, 0xdd, 0x6e, 0xa5, 0xc5, 0x69, 0x9b, 0x33, 0x53, 0xcf, 0xd9, 0xe7, 0xf3, 0xa9, 0xe8, 0xf9, 0x32, 0xa8, 0x66, 0xa5, 0xfd, 0xd2, 0x22, 0x3f, 0x4e, 0x5c, 0x26, 0x95, 0xf1, 0x75, 0xbe, 0x31, 0x2b, 0x45, 0x52, 0xc4, 0x4a, 0x91, 0xe2, 0x1b, 0x9d, 0x69, 0xb1, 0x1b, 0x9c, 0x70, 0xab, 0x55, 0x9a, 0xad, 0x3f, 0x7d, 0xdf, 0x16, 0x23, 0x1f, 0x84, 0xde, 0x87, 0x61, 0x1a, 0x17, 0x62, 0x2c, 0xe7, 0xa1, 0x58, 0x25, 0x5a, 0x66, 0xa1, 0xc5, 0x72, 0x24, 0x79, 0x7d, 0x1e, 0x8d, 0x87, 0x64, 0x2e, 0x0e, 0xf8, 0x7f, 0x00, 0x07, 0xef, 0xe5, 0x32, 0x14, 0xc4, 0x6c, 0x5c, 0x20, 0xb3, 0xfd, 0x06, 0x73, 0x71, 0x4f, 0xce, 0xeb, 0xbf, 0x8d, 0x53, 0x64, 0xc3, 0x53, 0xd4, 0x3d, 0xc6, 0x28, 0x97, 0xbf, 0x0c, 0xf5, 0xd2, 0xd7, 0x2c, 0x72, 0x63, 0x1b, 0x68, 0x64, 0x88, 0xa1, 0x9d, 0xa7, 0x7f, 0x5e, 0xdf, 0x3f, 0xc7, 0x39, 0x26, 0x1b, 0xe9, 0x35, 0x28, 0xaf, 0x80, 0x3c, 0x0b, 0xf9, 0x5d, 0xfc, 0x0d, 0xd6, 0x47, 0x7c, 0x21, 0x31, 0x05, 0x00, 0x00 };
-unsigned int index_htm_gz_len = 534;
+static const uint8_t script_js_gz[] PROGMEM = { 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x5a, 0x7b, 0x73, 0xdb, 0xc6, 0x11, 0xff, 0x9f, 0x9f, 0xe2, 0xcc, 0x66, 0x4a, 0x72, 0x42, 0x40, 0x78, 0xf1, 0x25, 0x5b, 0xca, 0xc4, 0x8e, 0xd3, 0xb8, 0x63, 0xcb, 0x1e, 0x4b, 0x99, 0x76, 0x9c, 0xf1, 0x54, 0x10, 0x79, 0x14, 0x51, 0x81, 0x00, 0x09, 0x1c, 0x45, 0x69, 0x1c, 0x7d, 0xf7, 0xfe, 0x76, 0xef, 0x00, 0x02, 0x24, 0xf5, 0x70, 0x9a, 0x76, 0x9a, 0x26, 0x51, 0x44, 0xdd, 0xed, 0xee, 0xed, 0xfb, 0x71, 0xc7, 0x58, 0x2a, 0x11, 0xe5, 0xa7, 0xe3, 0x30, 0x49, 0xa2, 0xe4, 0x52, 0x1c, 0x89, 0x69, 0x18, 0xe7, 0xf2, 0xb9, 0xe0, 0x7f, 0x0e, 0x0e, 0xc4, 0x9b, 0x64, 0x12, 0x8d, 0x43, 0x25, 0x73, 0x11, 0x4d, 0x45, 0x28, 0x12, 0xa9, 0xd6, 0x69, 0x76, 0x25, 0x72, 0x20, 0x00, 0x4f, 0x44, 0x89, 0x58, 0x64, 0xe9, 0x65, 0x26, 0xf3, 0xbc, 0x11, 0x33, 0xa9, 0x57, 0x69, 0x92, 0xc8, 0xb1, 0xda, 0x26, 0xb6, 0x4b, 0x6a, 0x6c, 0x00, 0xd3, 0x44, 0x84, 0x4a, 0xc9, 0xf9, 0x42, 0xed, 0x23, 0x48, 0x07, 0x7d, 0xaf, 0xb7, 0x73, 0x10, 0x74, 0x0c, 0x67, 0x4c, 0xf0, 0x2c, 0x0b, 0xc7, 0x57, 0xb9, 0x50, 0x33, 0x29, 0x92, 0xd5, 0xfc, 0x42, 0x66, 0x22, 0x9d, 0x6a, 0xce, 0x0c, 0xc1, 0xbc, 0x81, 0x43, 0x72, 0x25, 0xe6, 0xe1, 0xcd, 0x69, 0x9d, 0x4e, 0xef, 0xb9, 0x26, 0xf1, 0x2e, 0xbc, 0x89, 0xe6, 0xab, 0xf9, 0x36, 0x7e, 0x26, 0x55, 0x16, 0xc9, 0x42, 0xa4, 0x0f, 0xab, 0x7c, 0x66, 0xc4, 0x92, 0x93, 0x8d, 0x54, 0x40, 0x3f, 0x95, 0xd9, 0x35, 0xd0, 0x16, 0x00, 0x80, 0x58, 0xb9, 0x82, 0x74, 0x62, 0x3c, 0x0b, 0x93, 0x4b, 0xfc, 0x05, 0xb9, 0x0e, 0xe4, 0xb5, 0x4c, 0x54, 0xde, 0x15, 0x8b, 0x34, 0x8e, 0x49, 0x23, 0x17, 0x72, 0x9c, 0xce, 0xb1, 0x17, 0x8a, 0x3c, 0x4e, 0xd7, 0x44, 0x28, 0xbe, 0x80, 0x0c, 0x86, 0x4d, 0x82, 0x3a, 0x8b, 0xe6, 0x32, 0x23, 0x0e, 0xbf, 0x30, 0x27, 0x87, 0xe0, 0x2c, 0x8e, 0xbb, 0x62, 0x1d, 0x4d, 0x23, 0xfd, 0x59, 0xdc, 0x3d, 0x2f, 0x15, 0xf3, 0x17, 0x99, 0xc8, 0x2c, 0x64, 0x15, 0x6e, 0x54, 0x43, 0x6c, 0x91, 0x0c, 0xa4, 0x96, 0x7c, 0x96, 0xae, 0x13, 0x11, 0x47, 0x20, 0xae, 0x0f, 0x9e, 0x66, 0xe9, 0xbc, 0x2b, 0x80, 0xaf, 0xd5, 0x96, 0x6b, 0xfe, 0xc3, 0x24, 0x5f, 0xe3, 0xd7, 0x3a, 0x52, 0x33, 0xe1, 0x3b, 0x81, 0x48, 0xa1, 0x89, 0x24, 0xbe, 0x65, 0x10, 0x23, 0x0e, 0x9f, 0x79, 0x95, 0x80, 0xdc, 0x89, 0x76, 0x01, 0xe2, 0xf1, 0x97, 0xcf, 0x9b, 0x33, 0xdf, 0x86, 0x38, 0x24, 0x93, 0xc9, 0x44, 0x66, 0x50, 0x12, 0x1d, 0xd9, 0x15, 0x13, 0x19, 0xab, 0x10, 0xd2, 0x66, 0x52, 0x84, 0x8b, 0x45, 0x1c, 0x61, 0x03, 0xac, 0xaa, 0x74, 0x41, 0x8a, 0x8e, 0x14, 0xd3, 0x34, 0x6e, 0x70, 0x0a, 0x83, 0x6b, 0x39, 0x5a, 0xad, 0xe7, 0xa5, 0x81, 0xd3, 0x2b, 0x99, 0x10, 0x6c, 0xba, 0xca, 0xf6, 0xf8, 0x4b, 0x57, 0xa4, 0xe0, 0x10, 0xea, 0x9f, 0xa5, 0x09, 0x64, 0x9b, 0x87, 0xb7, 0x50, 0xb0, 0x58, 0xe5, 0xa4, 0x69, 0x62, 0x7d, 0x91, 0x66, 0x2a, 0x8c, 0x71, 0x5e, 0x6a, 0x14, 0x2c, 0x63, 0x39, 0x27, 0x83, 0x90, 0x7a, 0x1b, 0xc4, 0xe2, 0xa1, 0x98, 0xa4, 0xe3, 0x15, 0xad, 0xd9, 0x97, 0x52, 0xbd, 0xd6, 0xdb, 0x2f, 0x6f, 0xdf, 0x4c, 0xda, 0x2d, 0xd2, 0xb8, 0x45, 0x30, 0xad, 0x4e, 0xb7, 0x41, 0xca, 0x7e, 0xa9, 0x92, 0x07, 0xc0, 0x09, 0xc2, 0xba, 0x58, 0x29, 0x95, 0x26, 0x84, 0x30, 0x4f, 0x27, 0x61, 0xfc, 0x00, 0xf8, 0x22, 0xcc, 0x73, 0x68, 0x71, 0x62, 0x31, 0x20, 0x61, 0xd0, 0xca, 0x9b, 0x64, 0xb1, 0x52, 0x4f, 0xc1, 0x8a, 0x08, 0x90, 0xb0, 0x10, 0x8f, 0x27, 0xe1, 0x5c, 0x3e, 0x80, 0xc3, 0x07, 0x58, 0x26, 0x6e, 0xad, 0x04, 0xc0, 0x84, 0x67, 0x94, 0xf9, 0xb0, 0x4c, 0x06, 0xa8, 0x22, 0x16, 0x84, 0x1c, 0xcb, 0xf8, 0x11, 0x2c, 0x86, 0xa9, 0x20, 0x51, 0x58, 0xac, 0xf2, 0x77, 0xf9, 0xe5, 0x43, 0xea, 0x63, 0x18, 0x0b, 0x2e, 0x9a, 0x87, 0x97, 0xe0, 0xb0, 0x01, 0x2f, 0xd7, 0x36, 0x8b, 0xe8, 0x17, 0x1b, 0xac, 0x19, 0xa7, 0xe3, 0x2b, 0x8b, 0xec, 0xd2, 0x14, 0x87, 0xe7, 0x2f, 0xf2, 0xeb, 0x4b, 0x71, 0x33, 0x8f, 0x93, 0xfc, 0xa8, 0x39, 0x53, 0x6a, 0x71, 0x78, 0x70, 0xb0, 0x5e, 0xaf, 0xed, 0xb5, 0x6f, 0xa7, 0xd9, 0xe5, 0x81, 0xe7, 0x38, 0xce, 0x01, 0x20, 0x9a, 0x62, 0x26, 0xa3, 0xcb, 0x99, 0x3a, 0x6a, 0x7a, 0xc1, 0xe2, 0xa6, 0x09, 0x17, 0x9f, 0xa8, 0x59, 0xf1, 0xc7, 0x75, 0x24, 0xd7, 0x2f, 0xd3, 0x9b, 0xa3, 0xa6, 0x23, 0xac, 0x51, 0xdf, 0x11, 0xe6, 0xa7, 0x29, 0xc4, 0x34, 0x8a, 0xe3, 0xa3, 0xe6, 0x9f, 0x1c, 0xfe, 0xa7, 0x79, 0xfc, 0x62, 0x11, 0x22, 0x32, 0x26, 0x47, 0xcd, 0x77, 0x5e, 0xe0, 0x58, 0x43, 0x67, 0x69, 0xf9, 0xbe, 0x70, 0xac, 0x5e, 0xdf, 0xee, 0x59, 0x9e, 0x6f, 0xf7, 0xce, 0xdc, 0xbe, 0x63, 0xe1, 0xe7, 0xda, 0x0a, 0x1c, 0x67, 0xe9, 0xd0, 0x2e, 0x2d, 0x33, 0xc0, 0x19, 0xa1, 0xf4, 0x03, 0x67, 0x16, 0x60, 0x7b, 0x48, 0xbb, 0x43, 0x5f, 0xf4, 0x86, 0xd8, 0x75, 0x03, 0x17, 0xdb, 0xc1, 0xd0, 0xb1, 0x46, 0x9e, 0xb3, 0xc4, 0xaa, 0x23, 0x78, 0x89, 0x77, 0xcf, 0xfa, 0x58, 0x1f, 0x78, 0xce, 0xf5, 0x90, 0x30, 0x97, 0x74, 0x9e, 0x20, 0x72, 0x4c, 0xf8, 0x6c, 0xe8, 0xd0, 0xe9, 0xce, 0x35, 0x1f, 0x27, 0x7c, 0x9f, 0xb9, 0xe0, 0xfd, 0x33, 0xe0, 0xe0, 0x98, 0x9f, 0x70, 0xea, 0xa7, 0x39, 0x7d, 0x9a, 0xe1, 0x00, 0xe6, 0x8b, 0x96, 0x08, 0xe1, 0xd3, 0x9c, 0x38, 0x72, 0xbd, 0x0a, 0x51, 0x2d, 0x04, 0x08, 0x5a, 0x7e, 0x5f, 0xf3, 0x6f, 0x6d, 0xf8, 0x27, 0x06, 0x83, 0xa0, 0x2a, 0xb3, 0xe6, 0x01, 0xa4, 0x34, 0xb8, 0x30, 0xe2, 0x8a, 0x12, 0xdc, 0x1b, 0x3a, 0x9f, 0xde, 0x61, 0x8f, 0xe5, 0xf6, 0x4a, 0xc1, 0x7b, 0x40, 0xe8, 0x59, 0xc3, 0x9e, 0xc2, 0x0f, 0x3e, 0x2d, 0xb1, 0x00, 0x8a, 0xc3, 0x9e, 0xf0, 0xb1, 0xe4, 0xf7, 0xc4, 0xb0, 0x77, 0x4d, 0x88, 0xcc, 0x9e, 0x51, 0xa6, 0x20, 0x86, 0x9b, 0x07, 0xc7, 0x2f, 0xc8, 0x98, 0xc7, 0xe7, 0xdd, 0x46, 0x93, 0xe3, 0x72, 0x1a, 0x25, 0x93, 0xff, 0xb4, 0x13, 0xdc, 0xeb, 0x03, 0x24, 0x21, 0xd4, 0x07, 0xd6, 0xfb, 0x8e, 0xbb, 0x1c, 0xf9, 0xd6, 0x08, 0xf2, 0xbb, 0x3d, 0xb6, 0x68, 0x9f, 0xe5, 0x87, 0x79, 0x96, 0x6e, 0xe0, 0x41, 0xbb, 0x5e, 0x3f, 0x20, 0xc5, 0xf8, 0x67, 0xa3, 0x3e, 0x83, 0xc7, 0x50, 0xa0, 0xe8, 0x0d, 0x96, 0xd6, 0xd0, 0xa5, 0xff, 0xdc, 0x11, 0x91, 0x1a, 0x1a, 0xb5, 0xc1, 0x74, 0x4b, 0xcb, 0x75, 0x48, 0xcd, 0xee, 0x08, 0x5a, 0xf1, 0xc8, 0xb3, 0xdc, 0x81, 0xd5, 0x1b, 0x0d, 0xe2, 0xc0, 0x1d, 0x89, 0xc0, 0x73, 0x34, 0xfa, 0xa7, 0xb9, 0x3f, 0x0c, 0xa0, 0x9e, 0xb7, 0x83, 0xbe, 0x6b, 0x79, 0x7d, 0x0f, 0x58, 0x43, 0xe1, 0xba, 0x96, 0x8f, 0xff, 0xc3, 0x06, 0xca, 0x0a, 0xe0, 0x62, 0x36, 0x14, 0xdc, 0x1f, 0x12, 0x2d, 0x17, 0xb0, 0x7d, 0x2c, 0xf6, 0xe9, 0x23, 0xec, 0x80, 0x55, 0xfd, 0x59, 0xe9, 0xad, 0x25, 0x81, 0x01, 0x3f, 0xc0, 0xb2, 0x0a, 0xfa, 0x82, 0xa1, 0x60, 0x52, 0x0b, 0x34, 0x44, 0xe0, 0x9f, 0x0d, 0xdd, 0xa1, 0xe5, 0xbb, 0xa3, 0xd8, 0x75, 0x3c, 0x01, 0xf6, 0x98, 0x87, 0xfe, 0xa7, 0x77, 0xe4, 0xa1, 0x3e, 0xb9, 0x51, 0x40, 0x6e, 0x34, 0x80, 0xcb, 0x28, 0xc2, 0x19, 0x90, 0x03, 0x05, 0x16, 0x7f, 0x54, 0x16, 0xaf, 0xc3, 0x77, 0x02, 0xf2, 0x9d, 0x01, 0x88, 0x2a, 0xfc, 0x4d, 0x1a, 0x80, 0xdb, 0x04, 0x82, 0x3f, 0x2a, 0x5e, 0xff, 0xa4, 0xf5, 0x3a, 0x18, 0xec, 0x31, 0x37, 0x85, 0xa4, 0xf8, 0xef, 0x98, 0x7b, 0xe8, 0xd0, 0xbf, 0xf7, 0x99, 0xdb, 0x59, 0x8e, 0x7a, 0xd6, 0x08, 0xec, 0xba, 0x23, 0x36, 0x77, 0x61, 0x39, 0x36, 0xb8, 0xdf, 0x67, 0x83, 0x3b, 0x64, 0x70, 0x8a, 0x6c, 0x6d, 0x72, 0xe7, 0xad, 0x21, 0x40, 0xe1, 0x48, 0x3a, 0xf6, 0xfb, 0x01, 0xe2, 0x26, 0x58, 0x5a, 0x83, 0x91, 0x45, 0x69, 0x63, 0xe0, 0x59, 0x23, 0x57, 0xc1, 0xe2, 0x1e, 0x94, 0xbc, 0xb4, 0x46, 0x23, 0x36, 0xbf, 0x27, 0x7c, 0x5a, 0x1c, 0x78, 0x62, 0xe4, 0xc6, 0x00, 0x27, 0xb4, 0x3d, 0x9a, 0x71, 0xff, 0x87, 0x34, 0xd3, 0xb7, 0x46, 0x43, 0xe1, 0xc1, 0x47, 0xdd, 0x60, 0xa4, 0xa0, 0x07, 0xab, 0xe7, 0x42, 0x29, 0x03, 0x56, 0x8a, 0x0b, 0x95, 0x28, 0x68, 0x0d, 0x19, 0x6e, 0x54, 0x2a, 0x04, 0x29, 0x02, 0x3e, 0xdb, 0xf3, 0x97, 0x5e, 0x8f, 0x1c, 0xb8, 0x47, 0x21, 0xe4, 0x0d, 0x55, 0x9f, 0x52, 0x8f, 0x6b, 0xd2, 0x13, 0xfd, 0x01, 0xa7, 0x53, 0xb4, 0x29, 0xbc, 0x61, 0xec, 0x05, 0x80, 0x09, 0xe0, 0xda, 0x83, 0x21, 0xe2, 0x02, 0x0a, 0x82, 0xba, 0xad, 0x91, 0x53, 0x8f, 0x20, 0x97, 0x55, 0x48, 0x98, 0xbe, 0xcb, 0x31, 0xd4, 0x07, 0x2c, 0xe3, 0x0a, 0xfc, 0xec, 0x51, 0xa3, 0xf7, 0x87, 0x56, 0xa3, 0x37, 0x1a, 0x59, 0x81, 0xdb, 0x5b, 0xfa, 0x43, 0xa8, 0x4f, 0x50, 0x66, 0x80, 0xe8, 0x6a, 0x34, 0xb0, 0x28, 0x29, 0x2d, 0x7b, 0xd0, 0x86, 0x80, 0xcf, 0xd2, 0x1f, 0x6a, 0x88, 0x18, 0xc7, 0x66, 0xec, 0x0e, 0x7d, 0xa8, 0xdc, 0xff, 0x4d, 0x6a, 0x04, 0x9e, 0xc0, 0xcf, 0x1e, 0x35, 0xfa, 0x7f, 0x6c, 0x35, 0xfa, 0x9e, 0x15, 0x0c, 0xbd, 0x65, 0xcf, 0xe7, 0x44, 0xca, 0xd2, 0x1a, 0x85, 0xf4, 0xfa, 0xfe, 0xb2, 0x3f, 0xa2, 0x24, 0xe9, 0x7b, 0x08, 0x7e, 0x2e, 0xb3, 0x43, 0x02, 0x8e, 0x09, 0x0c, 0x3f, 0xbf, 0x4d, 0x91, 0x2e, 0xe5, 0xda, 0xfe, 0x1e, 0x45, 0x06, 0xff, 0x17, 0x09, 0xaf, 0x2a, 0x17, 0xfa, 0xb9, 0x30, 0xbf, 0x4d, 0xc6, 0x62, 0xba, 0x4a, 0x74, 0x13, 0x6f, 0xba, 0xcb, 0x36, 0xfa, 0xfe, 0x09, 0x26, 0x24, 0xb4, 0xb6, 0x5d, 0x9a, 0xb5, 0xb2, 0x54, 0xf1, 0x9c, 0xd5, 0x41, 0xc7, 0x87, 0x39, 0xb1, 0x5d, 0x9d, 0x28, 0x3b, 0x34, 0x98, 0xad, 0xb2, 0x84, 0x67, 0xaf, 0x0f, 0x19, 0x4f, 0x57, 0x62, 0xbe, 0x8a, 0x55, 0xb4, 0x88, 0xe5, 0x9e, 0x01, 0x21, 0x6f, 0xa8, 0xec, 0x96, 0xe8, 0xd4, 0xa7, 0x52, 0x95, 0xad, 0xe4, 0xf3, 0x46, 0x31, 0x0c, 0xd8, 0x9b, 0x5e, 0xd8, 0x9e, 0x44, 0x79, 0x78, 0x11, 0xf3, 0x90, 0x77, 0x3f, 0x90, 0x92, 0x37, 0x0a, 0xf4, 0x14, 0x1d, 0x7e, 0x24, 0x9a, 0xe3, 0x92, 0xb4, 0x6d, 0xdb, 0xcd, 0xa2, 0x6d, 0xc5, 0x00, 0xbb, 0xc0, 0x07, 0x09, 0x88, 0x70, 0x1d, 0x46, 0x4a, 0x4c, 0xa5, 0x1a, 0xcf, 0xda, 0xad, 0x03, 0x74, 0xba, 0x99, 0xe2, 0x2e, 0xb6, 0xd5, 0x05, 0x6b, 0x73, 0xa9, 0x66, 0xe9, 0xe4, 0x50, 0xb4, 0x3e, 0xbc, 0x3f, 0x3d, 0x6b, 0x75, 0x1b, 0x33, 0x19, 0x62, 0x82, 0xca, 0x0f, 0xc5, 0x97, 0x96, 0x39, 0xc3, 0x3a, 0xbb, 0x5d, 0xc8, 0x16, 0x20, 0x78, 0x84, 0x1a, 0xf3, 0xb8, 0x77, 0x70, 0x63, 0xc1, 0x0f, 0xac, 0x69, 0x9a, 0xcd, 0xad, 0x55, 0x16, 0xcb, 0x64, 0x9c, 0x4e, 0xe4, 0xa4, 0x75, 0xd7, 0x6d, 0x5c, 0xa4, 0x93, 0x5b, 0x0c, 0x8a, 0x72, 0x2d, 0x7e, 0xfe, 0xf8, 0xf6, 0x54, 0x86, 0xd9, 0x78, 0xf6, 0x21, 0xcc, 0xc2, 0x79, 0xde, 0xc6, 0x40, 0x59, 0x6a, 0x9a, 0x86, 0x88, 0xc3, 0x5d, 0x9d, 0x8b, 0x3b, 0x34, 0xde, 0x9d, 0x42, 0x04, 0xd3, 0x8c, 0x97, 0x12, 0x14, 0x22, 0xb1, 0x02, 0xda, 0x00, 0x23, 0xf3, 0x94, 0x8b, 0xe9, 0x15, 0x59, 0x6c, 0x67, 0x9a, 0x2b, 0xf7, 0x8d, 0x60, 0xd4, 0xf9, 0xb7, 0x5b, 0x7f, 0xb7, 0x0c, 0x44, 0xab, 0x23, 0x7e, 0xfd, 0x95, 0x46, 0xbe, 0x06, 0x8d, 0xaa, 0x98, 0x11, 0xda, 0xe6, 0x54, 0x90, 0xa7, 0x71, 0x58, 0xcf, 0x61, 0xd0, 0xd4, 0x78, 0x26, 0xc7, 0x57, 0xaf, 0x4a, 0x0b, 0x9f, 0xf2, 0xbc, 0x00, 0xa0, 0x3b, 0x0c, 0x75, 0xd0, 0xf2, 0x97, 0x6d, 0xfc, 0xae, 0x68, 0xc9, 0x2c, 0x4b, 0xb3, 0x16, 0x60, 0xc0, 0x83, 0x54, 0x06, 0x97, 0x10, 0x65, 0xbb, 0x65, 0xfe, 0xa2, 0xdd, 0x3b, 0xd0, 0x80, 0x56, 0xc7, 0x33, 0xd1, 0x66, 0x8c, 0x4e, 0x85, 0x58, 0x6b, 0x73, 0x22, 0x86, 0xf5, 0x08, 0x9e, 0xd1, 0xfa, 0x2a, 0xc2, 0xdb, 0x3e, 0x4f, 0x53, 0x62, 0x31, 0x3f, 0xb7, 0xf3, 0xab, 0x68, 0x41, 0x93, 0x3a, 0x1d, 0x68, 0xfc, 0x14, 0x0a, 0x7d, 0xb6, 0xb9, 0x8d, 0xe1, 0x10, 0xa8, 0xde, 0xcd, 0x6c, 0xf9, 0xa4, 0x99, 0x4a, 0xed, 0x71, 0x0c, 0x43, 0xbe, 0xc5, 0xa8, 0x6a, 0x87, 0x13, 0xcc, 0x52, 0x71, 0x1a, 0x4e, 0x00, 0xdf, 0x62, 0x0b, 0xb5, 0x9f, 0x95, 0xc7, 0x34, 0xbe, 0x6c, 0x7c, 0xf3, 0x1f, 0xec, 0x86, 0x7c, 0x4f, 0xb0, 0xdf, 0x41, 0x89, 0x76, 0xcb, 0xd8, 0xf8, 0x59, 0x0d, 0x81, 0x2c, 0xdd, 0x50, 0xb3, 0x2c, 0x5d, 0xb3, 0x9b, 0xbd, 0x26, 0x65, 0xb4, 0x5b, 0xfc, 0x4b, 0x30, 0x10, 0xf1, 0x7a, 0x6a, 0xd0, 0x49, 0x07, 0x95, 0x43, 0xb1, 0xaa, 0x2d, 0xb7, 0x75, 0xea, 0xd6, 0x65, 0xc6, 0x77, 0xe2, 0xfc, 0x80, 0x07, 0x6a, 0x3d, 0x16, 0x7e, 0x87, 0x89, 0x7e, 0x2c, 0x8f, 0xbe, 0xf9, 0x52, 0x07, 0xbb, 0x3b, 0x17, 0x88, 0x8a, 0x2a, 0x20, 0x9d, 0x48, 0x77, 0x0a, 0x66, 0xda, 0xcd, 0xe1, 0x55, 0xeb, 0x88, 0x2d, 0x5b, 0x3f, 0xdd, 0xd6, 0xe0, 0xec, 0xb0, 0x21, 0xbc, 0xc7, 0x73, 0xbc, 0xc3, 0xf2, 0xde, 0xa4, 0x72, 0x03, 0xd5, 0x15, 0x9a, 0x47, 0x48, 0xc6, 0xf7, 0x09, 0xab, 0x7c, 0x26, 0x74, 0xd2, 0xc1, 0x0a, 0xdd, 0x11, 0xdd, 0x12, 0x74, 0x08, 0x21, 0xd6, 0x22, 0x97, 0x90, 0x73, 0x92, 0xb3, 0xc2, 0xb6, 0x8f, 0xab, 0xf9, 0x7e, 0x2d, 0xac, 0x8d, 0xfb, 0x77, 0x6c, 0xd6, 0x5c, 0xfe, 0xb7, 0x48, 0xc1, 0x04, 0xd5, 0x40, 0xff, 0x67, 0x4e, 0x41, 0x62, 0x42, 0x0b, 0x6a, 0xa4, 0xf8, 0xae, 0x46, 0x64, 0xf5, 0x18, 0x82, 0xa5, 0xb8, 0xdc, 0xb9, 0x1a, 0x3a, 0xe1, 0xdb, 0xad, 0x07, 0xb9, 0x42, 0x44, 0x92, 0x1e, 0x37, 0x68, 0x74, 0x28, 0x78, 0x73, 0xc8, 0xcb, 0xe9, 0x52, 0xa7, 0x74, 0xdb, 0xef, 0xb3, 0x2c, 0xbc, 0xb5, 0xa3, 0x9c, 0x7f, 0xb7, 0x89, 0x9f, 0x0e, 0x0c, 0xc6, 0x7c, 0x1d, 0xf2, 0x35, 0xcf, 0xed, 0x0f, 0x74, 0xed, 0xd3, 0xae, 0x5d, 0x16, 0x75, 0x19, 0xa0, 0xb3, 0x09, 0x58, 0xf6, 0xab, 0x1a, 0x88, 0x8d, 0x34, 0x76, 0xa9, 0x66, 0x24, 0x6a, 0xe9, 0xe1, 0x74, 0xff, 0x62, 0x47, 0x88, 0xa8, 0xec, 0xa7, 0xb3, 0x77, 0x6f, 0xe9, 0x72, 0xe8, 0xc5, 0x24, 0xba, 0x16, 0xec, 0xf0, 0x47, 0xcd, 0xdc, 0x44, 0x46, 0xf3, 0xb8, 0x8c, 0x91, 0x8a, 0xf1, 0x90, 0x8d, 0x5f, 0x1c, 0x00, 0xfa, 0xb8, 0x45, 0x6e, 0xa8, 0x93, 0x09, 0x7b, 0x75, 0xb7, 0x16, 0x86, 0x1c, 0xc6, 0x5c, 0x54, 0xb4, 0x2f, 0xf4, 0x1c, 0x67, 0xe3, 0x0b, 0x1c, 0xe9, 0x8d, 0x5c, 0xa5, 0x1c, 0x41, 0xa4, 0xdb, 0x6d, 0xc7, 0xdf, 0x6b, 0x08, 0x9d, 0x20, 0x3b, 0xcf, 0x0b, 0xef, 0xaa, 0x50, 0x1c, 0xa7, 0x73, 0xd4, 0x2a, 0xca, 0xb5, 0xf9, 0x6a, 0x3c, 0x06, 0x9b, 0xd3, 0x55, 0x1c, 0xdf, 0x76, 0x05, 0xfd, 0xd2, 0x17, 0x75, 0x7b, 0x2e, 0xdf, 0x04, 0x07, 0x00, 0xdf, 0x82, 0x5d, 0x96, 0x06, 0xfa, 0x0a, 0x87, 0x48, 0x36, 0x57, 0x76, 0xff, 0x8e, 0xf5, 0x7e, 0x77, 0xcf, 0xaa, 0x2a, 0xf6, 0x22, 0x93, 0xe1, 0x95, 0xd1, 0x98, 0xef, 0x04, 0x5a, 0x63, 0xe1, 0x5c, 0x92, 0x4c, 0xa8, 0xf0, 0xb9, 0x58, 0x4b, 0x11, 0xc6, 0x00, 0x02, 0xa7, 0x94, 0x9e, 0xab, 0x42, 0xd5, 0x98, 0xdd, 0x4b, 0x76, 0x22, 0xa7, 0x21, 0xa8, 0x30, 0xd5, 0x9f, 0x13, 0x79, 0xb3, 0xd0, 0xf5, 0x4e, 0xe7, 0x81, 0x07, 0x0d, 0x7c, 0xbe, 0x03, 0x2e, 0xa8, 0xd8, 0x1e, 0x8a, 0x6f, 0xbe, 0xec, 0x4d, 0x2a, 0x77, 0xe7, 0x9c, 0xf6, 0xb6, 0x82, 0x26, 0xd9, 0x78, 0xdb, 0x03, 0xd5, 0x86, 0x3d, 0x64, 0x4f, 0x9d, 0x79, 0x62, 0x3c, 0x30, 0x7c, 0xf3, 0xf8, 0x47, 0x26, 0x20, 0x54, 0xaa, 0xef, 0xb2, 0x8b, 0xa3, 0x2b, 0xc1, 0xb0, 0x53, 0x97, 0xf6, 0x56, 0xd7, 0xf6, 0xa6, 0x30, 0x3d, 0xd8, 0xd3, 0x6c, 0xd5, 0x7c, 0x4a, 0xde, 0xdc, 0xc4, 0x16, 0xc9, 0x5b, 0xaf, 0x23, 0x7d, 0xd7, 0x01, 0x4d, 0xfa, 0xae, 0x80, 0xb6, 0x9e, 0xde, 0x7a, 0x54, 0xf2, 0xba, 0xde, 0xb8, 0x27, 0xa3, 0x57, 0xea, 0x77, 0xf5, 0x65, 0x61, 0xb7, 0x59, 0x80, 0xbe, 0xd1, 0xba, 0x3a, 0x1d, 0x6e, 0x2d, 0x7f, 0x88, 0xf2, 0x45, 0x1c, 0xde, 0x72, 0xe2, 0x0f, 0x45, 0x9c, 0x22, 0x06, 0x51, 0x01, 0xa2, 0xb9, 0x7c, 0x5a, 0x4f, 0x52, 0x75, 0xe5, 0x22, 0x9d, 0x54, 0x18, 0xd1, 0x49, 0x85, 0x77, 0x03, 0xd7, 0xa4, 0x86, 0x74, 0x2e, 0xd3, 0x44, 0xea, 0xd4, 0xc8, 0xa5, 0x00, 0x06, 0x0c, 0x13, 0x7d, 0xbd, 0x5d, 0xed, 0x6b, 0xa7, 0x8a, 0x5e, 0x29, 0x56, 0x59, 0xfe, 0xdb, 0xfb, 0x9d, 0x2a, 0x77, 0xde, 0x2e, 0x77, 0x9b, 0xb4, 0xb4, 0xe7, 0x08, 0xb3, 0x09, 0xd9, 0x5d, 0x87, 0xb5, 0xf5, 0xc8, 0x59, 0xa5, 0xe3, 0xf2, 0x2d, 0xb4, 0x6e, 0x54, 0xe8, 0xbe, 0x9a, 0x3c, 0x77, 0xeb, 0x0a, 0x9c, 0x15, 0xff, 0x2a, 0x4e, 0xc1, 0x15, 0x65, 0x3e, 0x5e, 0x7c, 0x62, 0xf4, 0x1a, 0x36, 0xab, 0x91, 0x5a, 0xf8, 0x85, 0x09, 0xd3, 0xaa, 0x8f, 0xdc, 0x9d, 0x7f, 0xb5, 0xae, 0x1e, 0x6c, 0x11, 0x75, 0xe7, 0xc3, 0xbe, 0x40, 0x15, 0xa8, 0x62, 0x2d, 0xe3, 0xd5, 0x5f, 0xd7, 0x31, 0x96, 0x31, 0x49, 0xb1, 0x2e, 0x93, 0xd7, 0xfc, 0x82, 0xd4, 0x2e, 0xa6, 0xa1, 0x67, 0xeb, 0x28, 0x99, 0xa4, 0x6b, 0x9b, 0x97, 0x4f, 0xe1, 0x08, 0x63, 0x59, 0x0e, 0x45, 0x26, 0x76, 0x72, 0x5e, 0x85, 0x86, 0x39, 0x87, 0x6d, 0xe0, 0xd0, 0xda, 0xe9, 0xe7, 0x28, 0x3a, 0x49, 0x03, 0xd9, 0x69, 0x92, 0x2e, 0x24, 0xe5, 0x71, 0x1c, 0x70, 0x74, 0x2c, 0xbe, 0xec, 0x79, 0xec, 0xe2, 0x9e, 0x93, 0x1e, 0x9d, 0x4a, 0x14, 0x16, 0xe6, 0x41, 0x1c, 0xf3, 0x40, 0x76, 0xc7, 0x36, 0x7d, 0x89, 0x7c, 0x9a, 0x4b, 0xea, 0x97, 0x8c, 0x6a, 0x72, 0x71, 0x81, 0xbe, 0x49, 0xe5, 0x32, 0x9e, 0x16, 0x44, 0xd1, 0xb7, 0x32, 0xa7, 0x6f, 0x59, 0x66, 0x14, 0x94, 0x56, 0x91, 0xb5, 0xa0, 0xbd, 0xb6, 0xd4, 0x07, 0xed, 0xb6, 0xc7, 0xa5, 0xe0, 0x31, 0x06, 0x1d, 0x7a, 0x39, 0x4b, 0x57, 0xaa, 0xbd, 0x79, 0x45, 0xe3, 0x06, 0xb9, 0x53, 0xaf, 0x07, 0xf7, 0x55, 0x30, 0x69, 0xc3, 0x37, 0x15, 0x33, 0xf1, 0x66, 0x72, 0x4f, 0xe7, 0xf3, 0xd7, 0xd3, 0xf7, 0x27, 0xf6, 0x22, 0xcc, 0x72, 0x09, 0xf0, 0x49, 0xa8, 0x42, 0xee, 0x67, 0x36, 0xda, 0xdc, 0x95, 0xc2, 0xf4, 0x1b, 0xf7, 0x49, 0x40, 0xc7, 0x68, 0x4a, 0xe2, 0xd9, 0x11, 0x42, 0xe2, 0xc7, 0x37, 0x27, 0x6f, 0x4e, 0x7f, 0x7a, 0xfd, 0x43, 0xeb, 0xe9, 0xa2, 0x55, 0x07, 0x8a, 0xc7, 0xb8, 0x31, 0x69, 0x6b, 0x9b, 0x9b, 0xca, 0x6c, 0x0c, 0x7e, 0xda, 0x55, 0x86, 0x5e, 0xbd, 0x3f, 0x39, 0x79, 0xfd, 0xea, 0x0c, 0x1c, 0x89, 0x3f, 0xff, 0xb9, 0xc6, 0xea, 0xeb, 0x8f, 0x1f, 0xdf, 0x7f, 0xa4, 0x4a, 0xfe, 0x18, 0xa3, 0x74, 0x28, 0xe5, 0xf5, 0xfd, 0x15, 0x46, 0x73, 0x5c, 0xf1, 0x7a, 0x4e, 0xb0, 0x08, 0x24, 0x0c, 0xaa, 0x63, 0xf3, 0x3a, 0xca, 0x49, 0x7d, 0x3f, 0xf5, 0x5f, 0x08, 0xf2, 0xb3, 0x99, 0x15, 0xab, 0x4b, 0x30, 0x2c, 0x02, 0xad, 0x40, 0x28, 0x28, 0x75, 0x77, 0x7c, 0xf5, 0x3b, 0x9d, 0xc8, 0x50, 0x89, 0x7c, 0x9d, 0xcf, 0x2a, 0xac, 0x54, 0xba, 0xa1, 0xa4, 0x6c, 0x84, 0xf8, 0x49, 0xb3, 0x53, 0x29, 0x89, 0x28, 0x14, 0x63, 0x76, 0x7a, 0x0a, 0xb7, 0x53, 0x34, 0x3c, 0xbf, 0xa0, 0xf1, 0x64, 0x28, 0x3b, 0x93, 0xf3, 0xf4, 0x5a, 0x42, 0x92, 0x72, 0x45, 0xf7, 0x73, 0x13, 0x7b, 0x1e, 0x2e, 0x0a, 0x9a, 0x64, 0x0a, 0xf3, 0xd1, 0xa6, 0x01, 0xbd, 0xf3, 0xb9, 0xec, 0x48, 0xcb, 0xd2, 0x6d, 0x4f, 0xa3, 0x18, 0x89, 0xbf, 0x8a, 0xf2, 0xac, 0x38, 0xd9, 0x9e, 0x85, 0x65, 0x7b, 0xa1, 0x09, 0x74, 0x1a, 0x74, 0x5b, 0x81, 0x7c, 0xd5, 0xd6, 0x87, 0xc2, 0x11, 0x88, 0x89, 0x1a, 0x07, 0x80, 0xc9, 0xd3, 0x4c, 0xb5, 0xdb, 0x21, 0x7a, 0x3b, 0x76, 0x87, 0x0b, 0x3b, 0x03, 0xb6, 0xb0, 0x44, 0xc8, 0x1f, 0xea, 0xaa, 0xb8, 0xaf, 0x9b, 0x81, 0x1e, 0xb6, 0xdf, 0x84, 0x37, 0xb3, 0x17, 0xb9, 0x57, 0x52, 0x6f, 0xee, 0xc5, 0x11, 0x7c, 0xc7, 0xe1, 0xf4, 0x59, 0x79, 0x8f, 0xff, 0xf6, 0x5b, 0x0d, 0x5c, 0x7b, 0xeb, 0x3f, 0x3e, 0xda, 0x7e, 0xb6, 0xff, 0x8a, 0xc9, 0xc0, 0x74, 0x42, 0x27, 0x69, 0xc9, 0x0e, 0x6a, 0xf9, 0x2a, 0x99, 0xd8, 0xe2, 0x03, 0x1c, 0x89, 0x4a, 0x0c, 0xda, 0x9a, 0xf0, 0x32, 0x44, 0x4f, 0x10, 0x23, 0x09, 0x67, 0x9b, 0x49, 0xe1, 0x81, 0xe1, 0x5a, 0x9b, 0xb3, 0x36, 0x5f, 0x17, 0xce, 0xff, 0xb4, 0xf9, 0xe2, 0xee, 0x21, 0xf6, 0x5b, 0x9b, 0x36, 0xdd, 0x46, 0xdf, 0xf1, 0x3a, 0x44, 0x67, 0x55, 0xb1, 0xf7, 0xb6, 0xe8, 0x70, 0x4e, 0xd8, 0xe4, 0xd5, 0x2c, 0x8a, 0x27, 0xed, 0x31, 0xaa, 0x94, 0x92, 0xe6, 0x40, 0xf3, 0xac, 0x5a, 0xe0, 0x96, 0x29, 0x6a, 0xe7, 0x7b, 0x14, 0x48, 0xcd, 0x1f, 0xa9, 0x1a, 0x71, 0xb9, 0xd5, 0xc3, 0xec, 0x18, 0x3a, 0x82, 0x36, 0xaa, 0x96, 0x7f, 0x90, 0x76, 0x19, 0x06, 0xa4, 0xfa, 0xa3, 0xcd, 0xeb, 0xae, 0x46, 0x2a, 0xa0, 0x5b, 0xd8, 0x25, 0x65, 0xe1, 0x57, 0xbd, 0x03, 0xe0, 0xd6, 0x2f, 0x02, 0x4f, 0xad, 0xb2, 0x76, 0x45, 0x97, 0x49, 0x18, 0xeb, 0x94, 0x0c, 0x08, 0xcc, 0x0f, 0xa7, 0xbc, 0xf2, 0x06, 0xdb, 0xa5, 0x93, 0x1b, 0xf7, 0xac, 0x62, 0xd0, 0x3e, 0xe0, 0xf9, 0xad, 0xf8, 0x97, 0x73, 0xa6, 0xfb, 0xcd, 0x97, 0x2a, 0xb1, 0xbb, 0xf3, 0xcf, 0x05, 0x06, 0xbd, 0x22, 0x33, 0xbc, 0xd8, 0x78, 0xab, 0x5d, 0xbd, 0x04, 0xfb, 0xce, 0xd0, 0xa9, 0xbc, 0x37, 0x7f, 0xa6, 0x56, 0xd5, 0x70, 0x99, 0xc6, 0xa8, 0x15, 0xe9, 0x65, 0x7b, 0x73, 0xb2, 0x91, 0xad, 0x6a, 0xce, 0xf3, 0x46, 0xd5, 0x1d, 0xb5, 0xa0, 0x80, 0x6c, 0x1e, 0x37, 0x0a, 0xbe, 0x08, 0xf1, 0xae, 0xa1, 0xfd, 0x6e, 0x0f, 0x70, 0x32, 0x4d, 0x9b, 0x7b, 0xd6, 0xe9, 0xfd, 0x9e, 0x89, 0x54, 0x23, 0xfe, 0x0e, 0x7f, 0x17, 0x52, 0xdd, 0x4f, 0x52, 0x1f, 0xdb, 0x3c, 0xde, 0xe0, 0x92, 0x22, 0xef, 0x26, 0x2f, 0xe7, 0x05, 0x86, 0xfe, 0x75, 0xae, 0xa5, 0xd9, 0x2d, 0x1f, 0xe3, 0x38, 0x1a, 0x5f, 0x51, 0xfd, 0xe0, 0x7c, 0x81, 0xf2, 0x0d, 0x75, 0x19, 0xc7, 0xa8, 0x25, 0xa0, 0xee, 0x3e, 0xad, 0x76, 0x36, 0x59, 0x0d, 0xd4, 0x6b, 0xc9, 0xa5, 0x4e, 0x49, 0x53, 0xf8, 0x9d, 0x2e, 0x82, 0xf3, 0xa2, 0xc6, 0xd5, 0xa8, 0xd5, 0x6f, 0x9e, 0xa9, 0xf5, 0xaf, 0x02, 0x30, 0xcd, 0xf7, 0xd4, 0x16, 0x19, 0x31, 0xf6, 0xc5, 0xaf, 0xf9, 0xde, 0xc5, 0xd6, 0x5d, 0x30, 0x11, 0xfc, 0x9a, 0xa6, 0x57, 0x84, 0xe0, 0xf2, 0x5a, 0x56, 0xd3, 0x4e, 0xf9, 0x35, 0x10, 0xfb, 0x3a, 0x8c, 0x57, 0xd2, 0x64, 0x86, 0x3d, 0xdb, 0x53, 0x04, 0x1b, 0x17, 0x50, 0xed, 0xd5, 0xa8, 0x3e, 0xaf, 0xca, 0x2b, 0x6a, 0x60, 0xed, 0xbb, 0xb8, 0x1e, 0x63, 0x92, 0x91, 0x27, 0x18, 0x5e, 0xdb, 0xd4, 0xd4, 0x75, 0xf6, 0xdf, 0x6e, 0xa3, 0xbf, 0xc1, 0x12, 0x41, 0xd9, 0xa6, 0xc4, 0xe8, 0x24, 0x53, 0x3b, 0xa0, 0xbb, 0x8f, 0xfe, 0x7e, 0x82, 0xba, 0x32, 0x6e, 0x50, 0xf7, 0x9f, 0xfa, 0x98, 0xb7, 0x15, 0x89, 0x86, 0xe4, 0xaf, 0x4a, 0xb7, 0xa5, 0x2e, 0x5d, 0x47, 0x68, 0xb1, 0xf3, 0xe8, 0xfb, 0xc2, 0x4e, 0xeb, 0x51, 0x8e, 0x3b, 0xf9, 0x65, 0x57, 0xa8, 0xdb, 0x85, 0x56, 0x7e, 0x97, 0x07, 0x3f, 0x74, 0x11, 0xf8, 0x8b, 0x7b, 0x84, 0x6a, 0x2a, 0x2e, 0xbf, 0xda, 0xb2, 0xe5, 0x08, 0x20, 0xf1, 0x7c, 0x1f, 0x54, 0xd5, 0x17, 0xce, 0xeb, 0xdf, 0x79, 0x31, 0xbe, 0x80, 0x79, 0x85, 0x8e, 0xbe, 0x43, 0x14, 0x56, 0x1a, 0x98, 0x42, 0x09, 0x8f, 0x90, 0xdc, 0xfe, 0x1a, 0x0d, 0xc4, 0x2b, 0xd9, 0xaf, 0xcb, 0x5a, 0xcf, 0xac, 0x9c, 0x51, 0x4d, 0x98, 0x71, 0x17, 0x80, 0xe2, 0x6b, 0xf5, 0x9c, 0x22, 0xca, 0x44, 0xf0, 0xbc, 0xbe, 0xd5, 0xdf, 0x6c, 0xf9, 0x5b, 0x5b, 0x83, 0xcd, 0x96, 0xb7, 0xb5, 0x35, 0xdc, 0x6c, 0xb9, 0x65, 0x32, 0x70, 0x6a, 0x6c, 0x99, 0xf7, 0x97, 0x97, 0xfc, 0xdd, 0xa1, 0xf6, 0x05, 0x39, 0x1a, 0x9c, 0xe7, 0x0c, 0xba, 0x25, 0xf6, 0x2e, 0xf6, 0xbd, 0xd0, 0x5c, 0xec, 0xbc, 0xc8, 0x18, 0x8c, 0xad, 0x06, 0x66, 0x7b, 0xee, 0x02, 0x5e, 0x41, 0x77, 0xef, 0x97, 0x16, 0x1f, 0x7b, 0x1f, 0x7a, 0x00, 0xaa, 0xce, 0x8e, 0x39, 0xa8, 0xee, 0x6a, 0xe5, 0x44, 0xb2, 0x7d, 0xc5, 0xbf, 0x4d, 0xf6, 0x49, 0x6d, 0xc8, 0x5d, 0xa3, 0x2c, 0xbd, 0x3b, 0x81, 0xd4, 0xfc, 0xe1, 0xfd, 0x3b, 0xc3, 0xcc, 0x5b, 0x60, 0xc8, 0x49, 0x73, 0x3b, 0xa6, 0xf8, 0x08, 0xd6, 0x78, 0xb5, 0x86, 0x3f, 0xf8, 0x05, 0x37, 0xdd, 0x4f, 0x68, 0xa4, 0x5a, 0xdd, 0x33, 0x95, 0x73, 0xf3, 0x25, 0x9d, 0xb2, 0xec, 0x4e, 0xc3, 0x6b, 0x53, 0xa5, 0xef, 0x3d, 0x02, 0x20, 0x84, 0x4f, 0xe4, 0x0d, 0xb4, 0x3d, 0xcb, 0xe4, 0x94, 0x1e, 0xd9, 0x68, 0xf0, 0x38, 0x8c, 0xe6, 0x70, 0x6a, 0x7a, 0x50, 0xfc, 0xf6, 0x66, 0x1e, 0x77, 0x9b, 0xe2, 0x5b, 0xa1, 0x1f, 0xbe, 0x7e, 0xfe, 0xf8, 0xe6, 0x55, 0x3a, 0xc7, 0x8c, 0x4f, 0xdd, 0xc6, 0x2e, 0x07, 0x26, 0xd2, 0x77, 0x54, 0xfa, 0x68, 0x85, 0xab, 0xcd, 0x56, 0xb5, 0xec, 0x56, 0x7c, 0x0d, 0xee, 0x09, 0x79, 0x6b, 0x67, 0xc8, 0xaa, 0x25, 0x90, 0x27, 0xdc, 0x8b, 0xd0, 0xad, 0x40, 0x67, 0x6f, 0x09, 0xd8, 0x3d, 0xfc, 0x4a, 0xde, 0x4e, 0xd0, 0x8e, 0x6f, 0x0f, 0x79, 0xd2, 0xc6, 0x06, 0xf7, 0xde, 0xad, 0xd7, 0xd4, 0xe0, 0xf1, 0x34, 0x57, 0x9f, 0xfc, 0x68, 0xbc, 0xbb, 0x27, 0xa9, 0xd6, 0x18, 0xae, 0x95, 0x13, 0x48, 0xda, 0xee, 0x14, 0x0c, 0xd6, 0xef, 0x2b, 0xb6, 0x46, 0x53, 0x5d, 0x70, 0xfe, 0x05, 0xbe, 0xab, 0x6f, 0x09, 0x6d, 0x2c, 0x00, 0x00 };
 
-const uint8_t script_js_gz[] PROGMEM= { 0x1f, 0x8b, 0x08, 0x08, 0x13, 0x89, 0x91, 0x67, 0x02, 0xff, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0xdd, 0x1b, 0x6b, 0x6f, 0xdb, 0x46, 0xf2, 0xfb, 0x01, 0xfd, 0x0f, 0x5b, 0x5d, 0x51, 0x49, 0x89, 0x28, 0xf3, 0xa5, 0x97, 0x1d, 0xfb, 0xe0, 0x38, 0x6e, 0x63, 0x9c, 0x1f, 0x81, 0x25, 0x1f, 0xd0, 0x1c, 0x8a, 0x9a, 0x16, 0x57, 0x12, 0xcf, 0x14, 0x29, 0x91, 0x2b, 0x3f, 0x10, 0xf8, 0xbf, 0xdf, 0xcc, 0xec, 0x92, 0x5c, 0x52, 0x92, 0xe3, 0x14, 0x6e, 0x71, 0x3d, 0xb7, 0x4e, 0x24, 0xee, 0xcc, 0xec, 0xbc, 0x1f, 0xbb, 0xcc, 0xce, 0x9b, 0xfd, 0x57, 0xf8, 0xf9, 0xee, 0x6f, 0x8c, 0xfd, 0x7c, 0x7c, 0x7e, 0x7c, 0x79, 0x78, 0xca, 0x86, 0xa3, 0xc3, 0xd1, 0xf1, 0x90, 0x35, 0xe8, 0x6f, 0x76, 0x76, 0x78, 0x7e, 0xf8, 0xf3, 0xf1, 0xd9, 0xf1, 0xf9, 0xa8, 0x89, 0x40, 0xaf, 0xb1, 0xd9, 0x9b, 0x1d, 0xa4, 0x14, 0x72, 0xc1, 0x82, 0x74, 0x38, 0xf6, 0xa2, 0x28, 0x88, 0xa6, 0x6c, 0x9f, 0x4d, 0xbc, 0x30, 0xe5, 0x7b, 0x8c, 0x7e, 0x76, 0x76, 0xd8, 0x49, 0xe4, 0x07, 0x63, 0x4f, 0xf0, 0x94, 0x05, 0x13, 0xe6, 0xb1, 0x88, 0x8b, 0xfb, 0x38, 0xb9, 0x65, 0x29, 0x20, 0x00, 0x1e, 0x0b, 0x22, 0xb6, 0x48, 0xe2, 0x69, 0xc2, 0xd3, 0xb4, 0xa0, 0x76, 0x14, 0x47, 0x11, 0x1f, 0x8b, 0x2a, 0xbd, 0x75, 0x6a, 0x63, 0x05, 0x18, 0x47, 0xcc, 0x13, 0x82, 0xcf, 0x17, 0x62, 0x0b, 0x4d, 0xdc, 0xee, 0x50, 0x42, 0xa4, 0x40, 0xd3, 0x54, 0xfc, 0x11, 0xcd, 0x51, 0xe2, 0x8d, 0x6f, 0x53, 0x26, 0x66, 0x9c, 0x45, 0xab, 0xf9, 0x0d, 0x4f, 0x58, 0x3c, 0x91, 0xfc, 0x29, 0x9a, 0x44, 0x05, 0xb6, 0x4a, 0x05, 0x9b, 0x7b, 0x0f, 0xc3, 0x32, 0xa9, 0xce, 0x9e, 0xa4, 0x72, 0xe6, 0x3d, 0x04, 0xf3, 0xd5, 0xbc, 0x4a, 0x22, 0xe1, 0x22, 0x09, 0x38, 0x51, 0x28, 0xa8, 0xf0, 0x90, 0xcf, 0x79, 0x44, 0xe8, 0x5f, 0xf0, 0x29, 0xf0, 0x18, 0xa4, 0x62, 0x97, 0xf9, 0xf1, 0x78, 0x85, 0x0b, 0xed, 0x29, 0x17, 0xc7, 0x12, 0xe6, 0xfd, 0xe3, 0x89, 0xdf, 0xa8, 0xdf, 0x07, 0x93, 0xc0, 0x40, 0x98, 0x7a, 0xb3, 0x25, 0x11, 0x90, 0xf8, 0x7b, 0x11, 0x3d, 0x83, 0x83, 0x10, 0xc6, 0xcd, 0x4a, 0x88, 0x38, 0xca, 0xb1, 0xe6, 0xb1, 0xef, 0x85, 0xcf, 0xe0, 0x2c, 0xbc, 0x34, 0x05, 0xf3, 0xf8, 0x06, 0x01, 0xe6, 0x68, 0xf8, 0xf8, 0x24, 0x5a, 0xac, 0xc4, 0x4b, 0x50, 0x03, 0x04, 0xcc, 0x51, 0xc1, 0xde, 0xe7, 0xde, 0x9c, 0x3f, 0x83, 0x48, 0x5b, 0x19, 0xca, 0x2f, 0x8c, 0x08, 0x80, 0x73, 0x64, 0x65, 0xde, 0xe7, 0xe5, 0x54, 0x40, 0x55, 0x51, 0x41, 0xfa, 0x31, 0x0f, 0xbf, 0x82, 0x4a, 0x30, 0x55, 0xcc, 0x54, 0x78, 0x62, 0x95, 0x9e, 0xa5, 0xd3, 0xe7, 0x94, 0x4b, 0x30, 0xc6, 0x1c, 0x5c, 0xcc, 0x9b, 0x02, 0xc3, 0x88, 0xf9, 0xb4, 0xf7, 0xdd, 0xdf, 0x0a, 0x1b, 0x07, 0xf8, 0x57, 0x61, 0xe0, 0x5a, 0x18, 0x8f, 0x6f, 0x0d, 0xb4, 0x63, 0x8d, 0xed, 0x5e, 0xbf, 0x4b, 0xef, 0xa6, 0xec, 0x61, 0x1e, 0x46, 0xe9, 0x7e, 0x6d, 0x26, 0xc4, 0x62, 0x77, 0x67, 0xe7, 0xfe, 0xfe, 0xbe, 0x7d, 0xef, 0xb4, 0xe3, 0x64, 0xba, 0x63, 0x9b, 0xa6, 0xb9, 0x03, 0x10, 0x35, 0x36, 0xe3, 0xc1, 0x74, 0x26, 0xf6, 0x6b, 0xb6, 0xbb, 0x78, 0xa8, 0xb1, 0xfb, 0xc0, 0x17, 0xb3, 0xec, 0xcb, 0x5d, 0xc0, 0xef, 0xdf, 0xc7, 0x0f, 0xfb, 0x35, 0x93, 0x19, 0x83, 0xae, 0xc9, 0xd4, 0x6f, 0x8d, 0xb1, 0x49, 0x10, 0x86, 0xfb, 0xb5, 0xbf, 0x9b, 0xf4, 0x53, 0x3b, 0x78, 0xb7, 0xf0, 0xc4, 0x8c, 0xf9, 0xfb, 0xb5, 0x33, 0xdb, 0x35, 0x8d, 0xbe, 0xb9, 0x34, 0x1c, 0x87, 0x99, 0x46, 0xa7, 0xdb, 0xee, 0x18, 0xb6, 0xd3, 0xee, 0x8c, 0xac, 0xae, 0x69, 0xc0, 0xef, 0x9d, 0xe1, 0x9a, 0xe6, 0xd2, 0xc4, 0x55, 0x7c, 0x4c, 0x00, 0x23, 0x44, 0xe9, 0xba, 0xe6, 0xcc, 0x85, 0xe5, 0x3e, 0xae, 0xf6, 0x1d, 0xd6, 0xe9, 0xc3, 0xaa, 0xe5, 0x5a, 0xb0, 0xec, 0xf6, 0x4d, 0x63, 0x60, 0x9b, 0x4b, 0x78, 0x6a, 0x32, 0x7a, 0x44, 0xab, 0xa3, 0x2e, 0x3c, 0xef, 0xd9, 0xe6, 0x5d, 0x1f, 0x31, 0x97, 0xb8, 0x1f, 0x43, 0x72, 0x44, 0x78, 0xd4, 0x37, 0x71, 0x77, 0xf3, 0x8e, 0xb6, 0x63, 0x8e, 0x43, 0x5c, 0xd0, 0xfa, 0x08, 0x70, 0x60, 0x9b, 0x8f, 0xb0, 0xeb, 0xe7, 0x39, 0x7e, 0x9a, 0xc1, 0x06, 0xc4, 0x17, 0x3e, 0x42, 0x84, 0xcf, 0x73, 0xe4, 0xc8, 0xb2, 0x35, 0xa2, 0x52, 0x08, 0x20, 0x68, 0x38, 0x5d, 0xc9, 0xbf, 0x51, 0xf0, 0x8f, 0x0c, 0xba, 0xae, 0x2e, 0xb3, 0xe4, 0x01, 0x48, 0x49, 0x70, 0xa6, 0xc4, 0x65, 0x39, 0xb8, 0xdd, 0x37, 0x3f, 0x9f, 0xc1, 0x1a, 0xc9, 0x6d, 0xe7, 0x82, 0x77, 0x00, 0xa1, 0x63, 0xf4, 0x3b, 0x02, 0x7e, 0xe1, 0xd3, 0x12, 0x1e, 0x00, 0xc5, 0x7e, 0x87, 0x39, 0xf0, 0xc8, 0xe9, 0xb0, 0x7e, 0xe7, 0x0e, 0x11, 0x89, 0x3d, 0xa5, 0x4c, 0x86, 0x0c, 0xd7, 0x76, 0x0e, 0xde, 0xa1, 0x31, 0x0f, 0xae, 0x95, 0x7b, 0xd5, 0x28, 0x98, 0x27, 0x41, 0xe4, 0xff, 0xd1, 0x9e, 0xb0, 0xd5, 0x11, 0x50, 0x4c, 0xd0, 0x21, 0xf0, 0xdf, 0x35, 0xad, 0xe5, 0xc0, 0x31, 0x06, 0xa0, 0x04, 0xab, 0x43, 0x66, 0xed, 0x92, 0x12, 0xc0, 0x46, 0x4b, 0xcb, 0xb5, 0x41, 0xc5, 0x76, 0xd7, 0x45, 0xed, 0x38, 0xa3, 0x41, 0x97, 0xc0, 0x43, 0xd0, 0x22, 0xeb, 0xf4, 0x96, 0x46, 0xdf, 0xc2, 0xff, 0xad, 0x01, 0x92, 0xea, 0x2b, 0xdd, 0x81, 0xfd, 0x96, 0x86, 0x65, 0xa2, 0xae, 0xad, 0x01, 0xa8, 0xc6, 0x46, 0xf7, 0xb2, 0x7a, 0x46, 0x67, 0xd0, 0x0b, 0x5d, 0x6b, 0xc0, 0x5c, 0xdb, 0x94, 0xe8, 0x9f, 0xe7, 0x4e, 0xdf, 0x05, 0x1d, 0x9d, 0xf6, 0xba, 0x96, 0x61, 0x77, 0x6d, 0xc0, 0xea, 0x33, 0xcb, 0x32, 0x1c, 0xf8, 0x13, 0x0c, 0x21, 0x0c, 0x17, 0xfc, 0xac, 0x0d, 0x5a, 0xee, 0xf6, 0x91, 0x96, 0x05, 0xb0, 0x5d, 0x78, 0xd8, 0xc5, 0x8f, 0x60, 0x0c, 0x78, 0x2a, 0x3f, 0x0b, 0xb9, 0xb4, 0x44, 0x30, 0xc0, 0x77, 0xe1, 0xb1, 0x70, 0xbb, 0x8c, 0xa0, 0xc0, 0xae, 0x06, 0xd0, 0x60, 0xae, 0x33, 0xea, 0x5b, 0x7d, 0xc3, 0xb1, 0x06, 0xa1, 0x65, 0xda, 0x0c, 0xd8, 0x23, 0x1e, 0xba, 0x9f, 0xcf, 0xd0, 0x4d, 0x1d, 0xf4, 0x25, 0x17, 0x7d, 0xa9, 0x07, 0x7e, 0x23, 0x10, 0xa7, 0x87, 0x5e, 0xe4, 0x1a, 0xf4, 0x51, 0x18, 0xf4, 0x1c, 0x1c, 0xc8, 0x45, 0x07, 0xea, 0x01, 0x51, 0x01, 0xdf, 0x51, 0x03, 0xe0, 0x3b, 0x2e, 0xa3, 0x8f, 0x82, 0x9e, 0x7f, 0x96, 0x7a, 0xed, 0xf5, 0xb6, 0xd9, 0x1c, 0x83, 0x93, 0xfd, 0x39, 0x36, 0xef, 0x9b, 0xf8, 0xdf, 0x36, 0x9b, 0x9b, 0xcb, 0x41, 0xc7, 0x18, 0x00, 0xcf, 0xd6, 0x80, 0x6c, 0x9e, 0x99, 0x8f, 0xac, 0xee, 0x74, 0xc9, 0xea, 0x26, 0x5a, 0x1d, 0x63, 0x5c, 0xda, 0xdd, 0x3c, 0x55, 0x04, 0x30, 0x30, 0x51, 0xd1, 0x4e, 0xd7, 0x85, 0x08, 0x72, 0x97, 0x46, 0x6f, 0x60, 0x60, 0x02, 0xe9, 0xd9, 0xc6, 0xc0, 0x12, 0x60, 0x76, 0x1b, 0x34, 0xbd, 0x34, 0x06, 0x03, 0xf2, 0x01, 0x9b, 0x39, 0xf8, 0xb0, 0x67, 0xb3, 0x81, 0x15, 0x02, 0x38, 0xa2, 0x6d, 0x53, 0x8f, 0xf5, 0x3f, 0xa4, 0x9e, 0xae, 0x31, 0xe8, 0x33, 0x1b, 0xbc, 0xd5, 0x72, 0x07, 0x02, 0x94, 0x61, 0x74, 0x2c, 0xd0, 0x4c, 0x8f, 0x34, 0x63, 0x81, 0x5e, 0x04, 0xa8, 0x0e, 0x12, 0xde, 0x20, 0xd7, 0x0a, 0x64, 0x0c, 0xf0, 0xde, 0x8e, 0xb3, 0xb4, 0x3b, 0xe8, 0xca, 0x1d, 0x0c, 0x26, 0xbb, 0x2f, 0xba, 0x98, 0x89, 0x2c, 0x95, 0xad, 0xf0, 0x0b, 0xb8, 0x9f, 0xc0, 0x45, 0x66, 0xf7, 0x43, 0xdb, 0x05, 0x18, 0x17, 0x9c, 0xbc, 0xd7, 0x87, 0x08, 0x01, 0x2d, 0x81, 0xce, 0x8d, 0x81, 0x59, 0x8e, 0x25, 0x8b, 0xf4, 0x88, 0x98, 0x8e, 0x45, 0xd1, 0xd4, 0x05, 0x58, 0xc2, 0x65, 0xf0, 0xbb, 0x4d, 0x97, 0xf6, 0x5f, 0x5a, 0x97, 0xf6, 0x60, 0x60, 0xb8, 0x56, 0x67, 0xe9, 0xf4, 0x41, 0x87, 0x0c, 0x13, 0x05, 0xc8, 0x2f, 0x06, 0x3d, 0x03, 0x73, 0xd4, 0xb2, 0x03, 0x2a, 0x61, 0xe0, 0xbd, 0xf8, 0x45, 0xf4, 0x21, 0xe4, 0x61, 0x31, 0xb4, 0xfa, 0x0e, 0xe8, 0xdd, 0xf9, 0x5d, 0xba, 0x04, 0x3c, 0x06, 0xbf, 0xdb, 0x74, 0xe9, 0xfc, 0xb5, 0x75, 0xe9, 0xd8, 0x86, 0xdb, 0xb7, 0x97, 0x1d, 0x87, 0x92, 0x2b, 0x89, 0xac, 0xb4, 0xd2, 0xe9, 0x3a, 0xcb, 0xee, 0x00, 0x13, 0xa7, 0x63, 0x43, 0x2e, 0xa0, 0xfa, 0xdb, 0x47, 0xe0, 0x10, 0xc1, 0xe0, 0xf7, 0xf7, 0x69, 0xd3, 0xc2, 0xfc, 0xdb, 0xdd, 0xa6, 0x4d, 0xf7, 0xff, 0x22, 0x09, 0x56, 0x84, 0xc3, 0xd6, 0x0f, 0xa6, 0x80, 0x57, 0x9b, 0xe1, 0x18, 0x3b, 0xba, 0xb8, 0x3c, 0x66, 0x3f, 0x5d, 0x9d, 0x1f, 0x8d, 0x4e, 0x2e, 0xce, 0x87, 0xf2, 0xd9, 0xeb, 0x0d, 0x6d, 0x92, 0xdb, 0x37, 0x44, 0xf6, 0x0d, 0x1b, 0xf2, 0xc8, 0x4f, 0x61, 0x9a, 0x4a, 0xf8, 0x72, 0xc5, 0xa1, 0x75, 0x15, 0x31, 0x0d, 0x43, 0xd7, 0x3b, 0xd0, 0xe5, 0x26, 0x82, 0x9a, 0xd6, 0x6b, 0x06, 0x30, 0x8b, 0x38, 0x88, 0x04, 0x98, 0x00, 0x94, 0x39, 0x1c, 0x9e, 0x7c, 0x68, 0xb1, 0xac, 0xe7, 0x6f, 0x31, 0x2f, 0xf2, 0x71, 0xe6, 0x12, 0x6a, 0x18, 0x93, 0xed, 0x71, 0x5b, 0xd1, 0x3f, 0x9c, 0x08, 0x98, 0x88, 0x52, 0xef, 0x0e, 0x06, 0xba, 0x16, 0x0b, 0x80, 0x84, 0x17, 0xc0, 0xf0, 0x33, 0x89, 0x13, 0x7d, 0x80, 0x93, 0x38, 0x60, 0x54, 0x18, 0xeb, 0x66, 0x7c, 0x7c, 0x7b, 0x94, 0x2f, 0x0d, 0x69, 0xa5, 0xd1, 0x54, 0xf4, 0x48, 0x02, 0x2f, 0x7d, 0x8c, 0xc6, 0x6c, 0xb2, 0x8a, 0x24, 0xb2, 0xa2, 0xd3, 0x48, 0xd3, 0xc0, 0x97, 0x7c, 0xc1, 0x46, 0xe9, 0x27, 0xc9, 0x11, 0xf7, 0x9b, 0x59, 0x1b, 0x0e, 0x53, 0x63, 0x43, 0x9f, 0x2f, 0x9b, 0x38, 0xa0, 0xad, 0x92, 0x68, 0x0f, 0x47, 0xb8, 0x4f, 0x09, 0xbf, 0x83, 0x0e, 0x9f, 0xcd, 0x57, 0xa1, 0x08, 0x16, 0x21, 0xdf, 0x30, 0x5e, 0xe6, 0x83, 0x1c, 0x63, 0x22, 0x79, 0xcc, 0xa8, 0xd2, 0x00, 0x78, 0xb5, 0xf0, 0x61, 0x30, 0x65, 0x93, 0xd0, 0x9b, 0xa6, 0xa4, 0x8f, 0xab, 0x93, 0x6c, 0xb5, 0x32, 0xd1, 0x8a, 0x64, 0xc5, 0xf7, 0xb2, 0xb5, 0x6c, 0x16, 0x6c, 0x17, 0xc3, 0x4e, 0xdb, 0x0f, 0x52, 0xef, 0x26, 0xe4, 0xfe, 0x4b, 0x60, 0x05, 0x7f, 0x10, 0x40, 0x5d, 0x20, 0xe3, 0xfb, 0xac, 0x36, 0xce, 0x37, 0x6a, 0xb7, 0xdb, 0xb5, 0xbd, 0x82, 0xdd, 0x6c, 0x2e, 0x81, 0xa9, 0x78, 0x01, 0x1f, 0x38, 0x00, 0x7b, 0x68, 0x07, 0x36, 0xe1, 0x62, 0x3c, 0x6b, 0xd4, 0x35, 0x63, 0xd7, 0x5b, 0x85, 0x60, 0x30, 0x33, 0x72, 0x31, 0x8b, 0xfd, 0x5d, 0x56, 0xff, 0x74, 0x31, 0x1c, 0xd5, 0x5b, 0xc5, 0xc2, 0x8c, 0x7b, 0x3e, 0x4f, 0xd2, 0x5d, 0xf6, 0xa5, 0xae, 0x18, 0x30, 0x46, 0x8f, 0x0b, 0x5e, 0x07, 0x50, 0x6f, 0xb1, 0x08, 0x71, 0x4e, 0x07, 0xcd, 0xed, 0x3c, 0x18, 0x10, 0xd7, 0x06, 0x18, 0x7b, 0x6e, 0xac, 0x92, 0x90, 0x47, 0xe3, 0xd8, 0xe7, 0x7e, 0xfd, 0x49, 0x23, 0x74, 0x13, 0xfb, 0x8f, 0xbb, 0x30, 0x29, 0xde, 0xb3, 0xab, 0xcb, 0xd3, 0x21, 0xf7, 0x92, 0xf1, 0xec, 0x93, 0x97, 0x78, 0xf3, 0xb4, 0xf1, 0x85, 0x15, 0x06, 0x45, 0x47, 0xdb, 0x5d, 0x37, 0x2d, 0x7b, 0x6a, 0x66, 0x94, 0x9e, 0x9a, 0x1b, 0xe4, 0x55, 0x23, 0x5a, 0x2e, 0x6e, 0x26, 0x3f, 0x29, 0xae, 0x51, 0xc6, 0xc0, 0x03, 0x86, 0x09, 0xf9, 0xfe, 0x8d, 0x37, 0xbe, 0x05, 0x8f, 0x57, 0xd0, 0x10, 0x1d, 0xe4, 0xf5, 0x17, 0xff, 0x6c, 0x31, 0xa9, 0x33, 0x70, 0x5d, 0x04, 0xd3, 0x1c, 0x04, 0x82, 0x06, 0x62, 0x07, 0xcc, 0x16, 0xa4, 0xb3, 0xdc, 0xee, 0xe0, 0x6d, 0xf9, 0x7e, 0xf1, 0x6d, 0x53, 0x57, 0x6b, 0x3a, 0x8b, 0xef, 0x61, 0xc6, 0x6c, 0x28, 0xfe, 0x9a, 0x7b, 0xda, 0x12, 0x17, 0xa3, 0x60, 0xce, 0xe3, 0x95, 0x68, 0x6c, 0x8c, 0x84, 0x16, 0x73, 0x20, 0x3d, 0x16, 0x18, 0x4f, 0xe0, 0x18, 0x60, 0x50, 0x8d, 0x38, 0x08, 0x72, 0x9c, 0x24, 0x71, 0x16, 0x74, 0xf9, 0xa9, 0x8b, 0xcf, 0x85, 0x17, 0x84, 0xe9, 0x56, 0x2e, 0x5a, 0xac, 0xce, 0x11, 0xaf, 0xae, 0xb3, 0x03, 0x12, 0x70, 0xa1, 0x78, 0x40, 0x06, 0x78, 0xa3, 0xae, 0xbe, 0x69, 0x60, 0x4f, 0xf2, 0xc3, 0x13, 0xcc, 0xdd, 0xe0, 0x4e, 0xac, 0x41, 0x64, 0x9a, 0xa5, 0x00, 0xf9, 0x08, 0x41, 0x01, 0x41, 0x45, 0xfe, 0xc6, 0x80, 0xb7, 0x85, 0x97, 0xa4, 0xc8, 0x1c, 0x7f, 0x18, 0xf3, 0x05, 0x4a, 0x97, 0xf3, 0x95, 0x71, 0x55, 0x2f, 0x24, 0x67, 0x13, 0x60, 0x1c, 0xfc, 0x66, 0x03, 0x87, 0x2f, 0xe0, 0x8f, 0xb8, 0x7b, 0x5a, 0xcf, 0x7c, 0x27, 0x51, 0x20, 0x02, 0x3a, 0x4e, 0x02, 0x7e, 0xe6, 0x31, 0x7c, 0x8b, 0x13, 0x75, 0x12, 0xa4, 0x9f, 0x53, 0x41, 0x66, 0x1b, 0x83, 0x82, 0xd8, 0xcd, 0x23, 0x88, 0x17, 0x86, 0xc8, 0x74, 0x96, 0x1c, 0x71, 0xfd, 0x9a, 0xc2, 0x1d, 0x9e, 0xe0, 0x89, 0x8b, 0x4c, 0x63, 0xd7, 0xcf, 0xe4, 0x2a, 0x04, 0x3b, 0x97, 0xe4, 0xd3, 0x46, 0x7a, 0x1b, 0x2c, 0xf0, 0x44, 0x29, 0x57, 0x55, 0x35, 0xad, 0x80, 0x43, 0x46, 0xb1, 0x60, 0x5e, 0x98, 0x40, 0xb8, 0x3d, 0x12, 0x72, 0x44, 0x79, 0x34, 0xcf, 0xd6, 0x9a, 0xbb, 0x82, 0x13, 0x12, 0x5b, 0x39, 0x98, 0xee, 0x89, 0xdf, 0x17, 0xc7, 0x74, 0x25, 0x4f, 0x2c, 0x9d, 0xde, 0x95, 0xf2, 0x8d, 0x96, 0x71, 0xd4, 0x79, 0x53, 0x7b, 0x1c, 0x42, 0x00, 0x9e, 0x06, 0xa9, 0x68, 0x7b, 0xbe, 0xdf, 0xa8, 0x87, 0xb1, 0xe7, 0x03, 0x62, 0xbd, 0x1c, 0x47, 0xb8, 0x5f, 0xe3, 0xfb, 0x5c, 0xb4, 0xe2, 0xb1, 0xb6, 0xab, 0x96, 0x8f, 0x7e, 0x23, 0x9e, 0x11, 0x74, 0x4b, 0x52, 0xc2, 0xcd, 0x4b, 0x2e, 0xa9, 0x04, 0x2a, 0xe1, 0x62, 0x80, 0xe9, 0x10, 0xa0, 0xca, 0x59, 0x12, 0xdf, 0x53, 0x5e, 0xa1, 0x60, 0x68, 0xd4, 0x55, 0x4c, 0x20, 0x06, 0x4a, 0x3b, 0xac, 0x92, 0x7d, 0x2a, 0x79, 0xb3, 0x66, 0x84, 0x23, 0x0c, 0x43, 0xd2, 0x34, 0xf9, 0x83, 0xb4, 0xf1, 0x5a, 0x5e, 0xfd, 0x0d, 0x17, 0x65, 0x88, 0xae, 0x0b, 0x52, 0xf8, 0x86, 0xb6, 0x25, 0x1e, 0x4d, 0x2a, 0x4f, 0x4b, 0x4b, 0x1a, 0x4c, 0x21, 0xdf, 0x60, 0x18, 0x95, 0xa9, 0xb6, 0x25, 0x81, 0x92, 0xf5, 0xc6, 0x1e, 0x84, 0xbe, 0x6d, 0xda, 0xbb, 0xc8, 0x27, 0xe9, 0x50, 0x3b, 0xfe, 0x54, 0xe9, 0xca, 0x81, 0x94, 0x32, 0xa6, 0x34, 0xe6, 0x51, 0x4e, 0x03, 0x1f, 0xd3, 0x35, 0x95, 0x1b, 0x19, 0x4f, 0x18, 0xdb, 0x01, 0x84, 0x4e, 0xf2, 0x71, 0x74, 0x76, 0x0a, 0x32, 0xd4, 0xdf, 0xf9, 0xc1, 0x1d, 0x23, 0x9b, 0xef, 0xd7, 0x32, 0x9f, 0xaa, 0x1d, 0xe4, 0xfe, 0xa2, 0x6d, 0x05, 0xe5, 0xe6, 0xdd, 0x0e, 0x40, 0x1f, 0xd4, 0x4b, 0x76, 0xd2, 0x72, 0x99, 0xee, 0xf7, 0xd5, 0x14, 0x26, 0xe3, 0x98, 0x2a, 0x71, 0xd9, 0x91, 0x48, 0xbc, 0x8e, 0x69, 0x16, 0xe2, 0x51, 0xf8, 0x97, 0xb6, 0x10, 0x31, 0xf9, 0x59, 0xa3, 0x4c, 0xae, 0x6a, 0xfd, 0x3c, 0xfd, 0xeb, 0x0a, 0x95, 0x45, 0xa0, 0xb9, 0x69, 0x53, 0x5b, 0xdf, 0x74, 0x1c, 0xcf, 0xa1, 0x21, 0xc0, 0x72, 0x93, 0xae, 0xc6, 0x98, 0x0b, 0x26, 0xab, 0x30, 0x2c, 0x29, 0x31, 0x33, 0xa3, 0x5e, 0x68, 0xf4, 0x9d, 0xfe, 0x93, 0xc6, 0x55, 0x0e, 0xb7, 0x30, 0x7e, 0x03, 0x91, 0x7e, 0x5b, 0xe1, 0xc8, 0xe7, 0x13, 0x0f, 0xba, 0x12, 0x62, 0xe8, 0x2a, 0xe2, 0x0f, 0x0b, 0x59, 0xfb, 0xca, 0x8e, 0xf8, 0x0d, 0xca, 0xb8, 0x5e, 0x23, 0xc2, 0xb0, 0x2e, 0xef, 0xb2, 0x1f, 0xbe, 0x6c, 0x74, 0xb9, 0xa7, 0xeb, 0x4a, 0xaa, 0xaf, 0x66, 0xa8, 0x42, 0xfe, 0x7b, 0x9e, 0x40, 0x92, 0x8f, 0x57, 0x91, 0xdf, 0x92, 0xae, 0xc6, 0x56, 0x8b, 0xac, 0xa5, 0x9c, 0xab, 0x43, 0xf2, 0x30, 0x98, 0x07, 0x42, 0xcf, 0x4d, 0x19, 0x76, 0x1b, 0x1a, 0x84, 0x29, 0x54, 0x5a, 0xe8, 0x54, 0x99, 0x59, 0xae, 0x97, 0xda, 0xb1, 0xfb, 0xdb, 0xb7, 0x7b, 0x7a, 0xaa, 0x61, 0x8d, 0xd2, 0xf1, 0xfe, 0xc1, 0x7e, 0xf5, 0x98, 0xbe, 0x59, 0x4e, 0x3c, 0x2f, 0xf4, 0x77, 0x72, 0xb4, 0xda, 0xc1, 0xb9, 0x26, 0x1b, 0x89, 0xd5, 0x66, 0x9f, 0x42, 0x8e, 0x1e, 0x82, 0xb2, 0x79, 0x53, 0x0f, 0x82, 0x20, 0x84, 0x1a, 0x92, 0x6c, 0xf4, 0xff, 0x67, 0x12, 0x68, 0xc2, 0xe7, 0xf1, 0x1d, 0xaf, 0xe6, 0xd0, 0x0d, 0xd1, 0x50, 0x49, 0x4e, 0xdf, 0x10, 0x54, 0x15, 0x22, 0x55, 0xcb, 0x9d, 0x97, 0xe4, 0xfa, 0x9e, 0x5d, 0x42, 0x0d, 0xe1, 0x49, 0xa9, 0xfe, 0xa1, 0x8a, 0xd6, 0xda, 0xcf, 0x75, 0xbd, 0x15, 0x42, 0xe7, 0x96, 0x84, 0x1e, 0xe9, 0xd8, 0x83, 0xdc, 0x97, 0x51, 0xda, 0x3f, 0xd0, 0xad, 0x50, 0xa6, 0x05, 0xfd, 0x22, 0x6c, 0x7d, 0x34, 0x0b, 0x42, 0xbf, 0x31, 0x06, 0xf7, 0x17, 0x5c, 0xb1, 0xa6, 0x0e, 0xdd, 0x33, 0x22, 0x4d, 0xcd, 0x0b, 0x8b, 0x8f, 0xeb, 0x97, 0x3b, 0x20, 0xdb, 0x25, 0x76, 0x05, 0x24, 0x8a, 0x74, 0xc2, 0x31, 0x88, 0x08, 0x46, 0x2a, 0x34, 0xf0, 0x2d, 0xad, 0x4a, 0x56, 0x5f, 0x55, 0xa8, 0x10, 0xc6, 0x7a, 0xb7, 0x42, 0x99, 0x62, 0x7b, 0x9f, 0xf2, 0x6d, 0x6e, 0xf7, 0x13, 0xd1, 0xa1, 0x8a, 0x8e, 0x64, 0x33, 0xb5, 0x96, 0x7d, 0x6c, 0x5b, 0x5f, 0x43, 0xf5, 0x2a, 0xad, 0xb6, 0xa8, 0x8a, 0xfb, 0x52, 0x17, 0x43, 0x33, 0x79, 0xb9, 0x67, 0x61, 0x1f, 0x82, 0x74, 0x11, 0x7a, 0x8f, 0xa9, 0x56, 0x46, 0x54, 0xd6, 0x6b, 0xa1, 0x32, 0x88, 0xc1, 0xac, 0xaf, 0x4e, 0x9f, 0x1b, 0xca, 0x36, 0x8f, 0x71, 0x1b, 0x3b, 0x9d, 0xaf, 0x0c, 0x27, 0x1a, 0x9b, 0x9a, 0x46, 0xbf, 0xbd, 0xc3, 0xd7, 0xea, 0xaa, 0x84, 0xf9, 0x5a, 0x45, 0xd5, 0x3a, 0xd0, 0xca, 0xb5, 0xe2, 0xf6, 0x16, 0x1a, 0x8c, 0xdf, 0xa5, 0x40, 0x44, 0x02, 0x4a, 0x99, 0x34, 0x32, 0x78, 0x2c, 0x8c, 0xa3, 0x29, 0x46, 0x18, 0x44, 0xef, 0x96, 0x2a, 0xf9, 0xa2, 0x8e, 0x7f, 0x5b, 0x99, 0x28, 0x55, 0x4b, 0x8d, 0xf5, 0xf5, 0x9a, 0xf9, 0x82, 0xbe, 0xff, 0x85, 0x9d, 0xff, 0xb3, 0xbc, 0xd8, 0xeb, 0xbc, 0x14, 0x05, 0xf4, 0x79, 0x86, 0x14, 0x1c, 0x28, 0xd3, 0x32, 0x37, 0xf4, 0x0a, 0x2f, 0xe4, 0x2c, 0x0f, 0x3a, 0xba, 0x66, 0x94, 0xd9, 0x17, 0x2f, 0x24, 0x31, 0xea, 0x2a, 0xb7, 0x9d, 0x64, 0xae, 0xa3, 0x30, 0xc6, 0xcc, 0x8e, 0xb5, 0x0a, 0x1f, 0xbe, 0x5e, 0x5d, 0x56, 0xf2, 0xe9, 0x85, 0x37, 0x73, 0x42, 0x55, 0x75, 0x75, 0x87, 0x7c, 0xba, 0x7e, 0x3d, 0x93, 0x7c, 0xdb, 0x78, 0x56, 0x4c, 0x63, 0xcc, 0x5f, 0x25, 0x98, 0x24, 0xb4, 0x0c, 0x42, 0xce, 0xb9, 0x96, 0xf7, 0x64, 0x5b, 0x4d, 0x6b, 0x15, 0x78, 0x15, 0xb1, 0xaf, 0x33, 0xb4, 0xbd, 0xde, 0xe1, 0xda, 0xf0, 0xea, 0xd3, 0xa7, 0x8b, 0xcb, 0xd1, 0xc9, 0xf9, 0xcf, 0x7f, 0xd6, 0x11, 0xdb, 0x11, 0x15, 0x35, 0xec, 0xbf, 0x19, 0xe5, 0x7c, 0xe5, 0x96, 0x98, 0xde, 0x7d, 0x95, 0x20, 0x3c, 0x59, 0x85, 0xf3, 0xca, 0x4b, 0x27, 0x0e, 0x78, 0x8b, 0x4c, 0x4d, 0x7b, 0x1a, 0x4c, 0x23, 0x2f, 0x84, 0x1c, 0x34, 0x89, 0xb3, 0x34, 0x7d, 0x01, 0xf6, 0x08, 0x83, 0xf1, 0x6d, 0x8b, 0xd2, 0x79, 0x0a, 0x49, 0x24, 0x04, 0xf5, 0xa9, 0xc2, 0x09, 0x69, 0x16, 0x68, 0x07, 0x6a, 0xbe, 0xd5, 0x6c, 0xa2, 0xe7, 0xeb, 0x22, 0x53, 0x3f, 0x57, 0x73, 0x33, 0x2f, 0x91, 0xd9, 0x16, 0x2b, 0xd5, 0x7e, 0x71, 0x31, 0x2e, 0x31, 0x33, 0x94, 0x3a, 0xac, 0xe6, 0xf6, 0x83, 0xcf, 0xe5, 0x78, 0xa3, 0x24, 0x1e, 0x40, 0x9d, 0xae, 0xab, 0x9b, 0xf2, 0x8c, 0xa6, 0x14, 0xee, 0x5c, 0xbe, 0x39, 0xb1, 0xcf, 0xa6, 0x5c, 0x0c, 0xe9, 0xc9, 0x09, 0x2c, 0x67, 0x6c, 0xb4, 0x93, 0x34, 0x0d, 0x32, 0xd2, 0x3a, 0x1a, 0x02, 0x01, 0x12, 0xdd, 0xb7, 0xff, 0xfb, 0x9a, 0xf6, 0xf8, 0xe1, 0x8b, 0x4e, 0xf1, 0xe9, 0xfa, 0xd7, 0x12, 0x1a, 0xde, 0xc4, 0x13, 0x12, 0x98, 0x3b, 0xd3, 0x76, 0x5b, 0x3f, 0x51, 0xfa, 0x87, 0x22, 0xa6, 0xdd, 0xd9, 0xff, 0xca, 0x76, 0x65, 0x93, 0x53, 0x10, 0x8a, 0x43, 0xde, 0x0e, 0xe3, 0x69, 0xa3, 0xe0, 0xa2, 0x99, 0xaf, 0xa3, 0xe8, 0x7a, 0x81, 0xbf, 0xce, 0xdc, 0x5e, 0x2f, 0xf4, 0x52, 0x1d, 0x80, 0x57, 0x3b, 0x28, 0x02, 0x37, 0x63, 0x1d, 0xe9, 0xe5, 0x1d, 0x9f, 0x2c, 0xfa, 0xdb, 0x69, 0x80, 0x53, 0xe8, 0x34, 0xd6, 0x00, 0xf0, 0xa5, 0x0a, 0x1d, 0x00, 0xb7, 0xc9, 0x04, 0xc7, 0x03, 0xb6, 0xa7, 0xf2, 0x52, 0xa6, 0x20, 0xed, 0x71, 0x99, 0x83, 0x0d, 0x5b, 0x48, 0xae, 0x6b, 0x07, 0x05, 0x61, 0xb4, 0xd7, 0x93, 0xff, 0x7e, 0x5e, 0x61, 0x5e, 0xfb, 0x76, 0xad, 0x25, 0x53, 0xd4, 0x98, 0xe7, 0xfb, 0xc7, 0x78, 0x00, 0x8b, 0xdd, 0x31, 0x07, 0xe5, 0x35, 0xea, 0xe4, 0xdf, 0x90, 0x3e, 0xc0, 0x9b, 0xa1, 0x7d, 0x2c, 0x3b, 0xb8, 0x2e, 0x40, 0x6b, 0x93, 0x1d, 0xf3, 0x66, 0x51, 0x76, 0xc1, 0xb8, 0xc5, 0xde, 0x96, 0x7e, 0x49, 0xe6, 0xbe, 0x94, 0xad, 0x52, 0x70, 0xc0, 0x00, 0xfb, 0x44, 0x4f, 0x06, 0xc6, 0xfd, 0x8c, 0x47, 0x6a, 0x5f, 0x4c, 0x6d, 0xf9, 0xfb, 0x4b, 0xbb, 0x0a, 0xd1, 0xc0, 0xe9, 0x27, 0x86, 0xe6, 0xb5, 0x05, 0xe4, 0x13, 0x80, 0x0a, 0x1f, 0x55, 0x34, 0x66, 0x27, 0xd2, 0x4d, 0x0a, 0x64, 0xa8, 0xec, 0x80, 0x9c, 0x15, 0x9c, 0xb6, 0x8e, 0xbd, 0xc8, 0xf8, 0x6d, 0x51, 0x46, 0xc5, 0x83, 0x78, 0x2a, 0x3d, 0xd4, 0x31, 0x64, 0x18, 0x8c, 0xde, 0xaa, 0xd9, 0x18, 0xbb, 0x65, 0xad, 0x48, 0x6d, 0xbc, 0xe6, 0xd1, 0xb7, 0x76, 0xe4, 0xad, 0x4e, 0x91, 0xd6, 0x69, 0xb3, 0xca, 0x01, 0x3c, 0xb6, 0x40, 0x3a, 0x1c, 0xed, 0x71, 0x01, 0x6a, 0xca, 0xf4, 0x57, 0x94, 0x01, 0x6d, 0x40, 0xd1, 0xc6, 0x13, 0x62, 0x29, 0x8b, 0xc7, 0x4c, 0xe7, 0xa4, 0x9f, 0xad, 0xca, 0x91, 0x88, 0x79, 0xbd, 0x57, 0x2f, 0x1e, 0x55, 0xce, 0xc7, 0x91, 0xbd, 0xbd, 0x0a, 0xe4, 0x57, 0x3b, 0x03, 0x86, 0xce, 0x70, 0xc7, 0xeb, 0x55, 0xc4, 0xfc, 0xb5, 0xa8, 0xf6, 0x9d, 0x17, 0xae, 0xb8, 0x3e, 0x07, 0x6d, 0x80, 0x99, 0x40, 0xca, 0x4c, 0x4b, 0xed, 0x28, 0x4d, 0x29, 0x90, 0xfb, 0xc7, 0xb2, 0xe1, 0x50, 0xa6, 0x61, 0xf2, 0x75, 0x24, 0x4c, 0xdf, 0x72, 0x42, 0x64, 0x71, 0xe8, 0x33, 0x69, 0x9e, 0x50, 0x45, 0x46, 0xaa, 0xe7, 0x33, 0x98, 0xea, 0x8f, 0xf2, 0xfb, 0x00, 0x60, 0x62, 0xd3, 0x2d, 0xc1, 0x18, 0x1a, 0x4f, 0x7e, 0x0e, 0x13, 0x7e, 0x03, 0x0f, 0xf8, 0x9a, 0x55, 0x2e, 0x35, 0xc8, 0x85, 0x97, 0xc0, 0x23, 0x04, 0x85, 0x01, 0x95, 0x98, 0x93, 0x63, 0x59, 0x69, 0x97, 0xd6, 0x26, 0xd4, 0x67, 0xa8, 0x52, 0xa2, 0xd5, 0xf0, 0xcb, 0x4a, 0x50, 0x9d, 0x07, 0x05, 0x3b, 0x0e, 0x18, 0xc7, 0x18, 0x80, 0xec, 0x96, 0x3f, 0x32, 0x50, 0xc3, 0xb3, 0x46, 0xd6, 0xf8, 0xfe, 0x5a, 0xf2, 0xa8, 0x4c, 0x1a, 0x48, 0x56, 0xd7, 0x55, 0xc5, 0x96, 0x7b, 0xfa, 0xe1, 0x04, 0xae, 0x35, 0xbf, 0x7a, 0xc5, 0x94, 0x39, 0x71, 0x73, 0xef, 0x0f, 0xeb, 0x5b, 0xae, 0x4e, 0xd8, 0xe1, 0xf9, 0x07, 0x76, 0x35, 0x3a, 0x39, 0x3d, 0x19, 0xfd, 0xf2, 0x67, 0xf5, 0x2e, 0xf9, 0x38, 0xe8, 0xe5, 0xa3, 0x16, 0x8c, 0x42, 0xe8, 0xb1, 0xed, 0xf2, 0x6b, 0x70, 0x79, 0x57, 0x23, 0x67, 0x1d, 0xe8, 0x8d, 0x83, 0x08, 0x47, 0x58, 0x39, 0xd9, 0x64, 0x49, 0x0f, 0xef, 0x88, 0xf0, 0xed, 0x3c, 0x76, 0xc3, 0xb3, 0xb6, 0xb0, 0xd4, 0xed, 0xe3, 0x84, 0x09, 0x93, 0xfc, 0xe3, 0xe6, 0x64, 0x97, 0x8d, 0x09, 0xe9, 0xb4, 0xc5, 0x04, 0x52, 0xda, 0xa7, 0x64, 0xa3, 0xf6, 0x80, 0x6f, 0x34, 0x28, 0x65, 0xd6, 0x2e, 0x4e, 0x5f, 0xb2, 0x77, 0xfa, 0x2a, 0xf9, 0x00, 0xe8, 0xec, 0x6d, 0x05, 0xd5, 0x53, 0xc2, 0x75, 0x45, 0x54, 0x99, 0x12, 0xa0, 0x58, 0x22, 0x13, 0x4f, 0xd7, 0x8a, 0x88, 0x36, 0xc7, 0x55, 0xbc, 0xee, 0x2b, 0xe4, 0xab, 0x2f, 0x14, 0x66, 0xce, 0x94, 0x4b, 0xd6, 0xdc, 0x56, 0xba, 0x2e, 0x29, 0x83, 0xa2, 0x71, 0xd4, 0x9b, 0xa7, 0x81, 0x7c, 0x45, 0x16, 0xcb, 0x95, 0x6a, 0x1a, 0x53, 0x91, 0xc8, 0x53, 0xb5, 0x86, 0x69, 0xb8, 0x4d, 0x76, 0x03, 0x83, 0x99, 0x8f, 0xa1, 0x75, 0x39, 0x1c, 0x9e, 0xe4, 0x56, 0x99, 0x05, 0x69, 0x4e, 0x81, 0x0a, 0xa1, 0x9f, 0x59, 0x99, 0x7a, 0x50, 0x6c, 0x21, 0x58, 0x83, 0x4a, 0xfd, 0x79, 0x3b, 0xbd, 0x9b, 0x36, 0x37, 0x9a, 0xa7, 0xdc, 0xb9, 0x51, 0xc7, 0xa6, 0x97, 0x1f, 0x7c, 0x80, 0xc7, 0x73, 0x46, 0xc7, 0xcc, 0xaa, 0x0f, 0x73, 0xf7, 0x36, 0xac, 0x77, 0x8b, 0x75, 0x67, 0xd3, 0x7a, 0xaf, 0x58, 0xb7, 0x37, 0xad, 0xf7, 0x8b, 0x75, 0xab, 0xdc, 0x04, 0x98, 0xdb, 0xf4, 0xf8, 0x41, 0xde, 0xb9, 0xa2, 0x22, 0x55, 0x02, 0xc6, 0xb6, 0x7b, 0x3c, 0xf3, 0x60, 0x60, 0x4f, 0x19, 0xde, 0x57, 0xa3, 0xe7, 0xb4, 0xd9, 0x08, 0xd3, 0xb2, 0xc1, 0x23, 0x04, 0x6e, 0xa1, 0x9e, 0x36, 0x8c, 0x32, 0x4d, 0xba, 0x4e, 0xf2, 0xa2, 0x15, 0x74, 0x02, 0x9b, 0xfd, 0x58, 0xdd, 0xf0, 0xbe, 0xa7, 0x9d, 0x1a, 0x37, 0x98, 0x51, 0x21, 0x41, 0x8e, 0x60, 0x87, 0x5c, 0x61, 0x37, 0x5b, 0x2f, 0x82, 0x6f, 0xd6, 0xae, 0x7d, 0x15, 0xee, 0x76, 0x1f, 0x01, 0x0e, 0xe5, 0x71, 0x90, 0xb7, 0xa0, 0xc3, 0x58, 0x94, 0x27, 0x8a, 0x93, 0x39, 0x78, 0x47, 0x65, 0x5c, 0x03, 0xa1, 0x48, 0x38, 0xf4, 0x9f, 0x0d, 0x55, 0x89, 0x66, 0x11, 0x2e, 0xc8, 0xbd, 0x72, 0xa5, 0x6c, 0x92, 0x70, 0x5d, 0x2b, 0xc0, 0x76, 0x49, 0xc0, 0x8d, 0xef, 0x79, 0x6f, 0x4f, 0xf0, 0x9a, 0x2e, 0xbe, 0x06, 0x5a, 0x56, 0x8e, 0xda, 0x77, 0x9b, 0x72, 0x86, 0x22, 0x5e, 0xa4, 0xf9, 0xdd, 0x0e, 0x5d, 0x6b, 0x64, 0xf7, 0x7d, 0xe0, 0x53, 0xa5, 0xcb, 0x94, 0x71, 0xc8, 0xbd, 0x24, 0x53, 0x8c, 0x3a, 0xb6, 0x95, 0x4a, 0xc3, 0xf7, 0xbd, 0xe9, 0x22, 0x8e, 0xb4, 0xb4, 0x39, 0x75, 0xe5, 0x27, 0xf3, 0x85, 0x02, 0xd6, 0x5e, 0x9b, 0xaf, 0xe6, 0xa2, 0x17, 0x1e, 0x1a, 0xff, 0x21, 0xd5, 0x26, 0xfb, 0x87, 0x04, 0xc7, 0xff, 0x3a, 0x3e, 0x1f, 0xb1, 0xd3, 0x93, 0xe1, 0x08, 0x1f, 0x0c, 0x59, 0xe3, 0xf4, 0xe2, 0xf0, 0x03, 0x3e, 0xbd, 0xfc, 0x65, 0xf4, 0x11, 0x66, 0xe8, 0xe6, 0x1f, 0x51, 0x7e, 0xf2, 0x01, 0x73, 0xad, 0xae, 0xd7, 0x3e, 0x5c, 0x9c, 0x29, 0xe3, 0x9e, 0x82, 0x12, 0xb8, 0x5f, 0xab, 0x94, 0x78, 0x35, 0x1c, 0xa2, 0xea, 0xa4, 0xcf, 0xee, 0xbf, 0xf0, 0x25, 0xf9, 0x3d, 0xed, 0xd5, 0x7a, 0x69, 0x47, 0x7d, 0x86, 0x53, 0x33, 0x61, 0xf1, 0xf6, 0xee, 0xaf, 0x95, 0x29, 0x76, 0xe2, 0xdd, 0xa9, 0x59, 0x74, 0xeb, 0x76, 0x00, 0x82, 0x64, 0xf2, 0xad, 0x14, 0x4a, 0x7b, 0x96, 0xf0, 0x09, 0xbe, 0xbd, 0xe1, 0x7b, 0xc2, 0xdb, 0x0d, 0xe6, 0x50, 0x01, 0xf0, 0xe5, 0xa2, 0xb7, 0x0f, 0xf3, 0xb0, 0x55, 0x63, 0x6f, 0x99, 0x7c, 0x69, 0xe2, 0xea, 0xf2, 0xe4, 0x28, 0x9e, 0x2f, 0xa0, 0x91, 0x83, 0x49, 0x7b, 0x9d, 0x9b, 0x62, 0xfa, 0x24, 0x8f, 0xc8, 0xbe, 0xd2, 0x3f, 0x70, 0x08, 0xa6, 0x78, 0xea, 0x98, 0xfb, 0x37, 0x30, 0x59, 0x43, 0xd7, 0xab, 0x65, 0x51, 0x4d, 0xad, 0x12, 0x42, 0xaf, 0x79, 0xde, 0xf6, 0xb6, 0x4a, 0xbf, 0x79, 0x28, 0xba, 0xda, 0xa2, 0x9d, 0xab, 0x1d, 0xd1, 0xdb, 0xf5, 0xe5, 0x3d, 0xb2, 0x9a, 0x92, 0x77, 0x75, 0xf9, 0x29, 0x5b, 0x11, 0xc7, 0xd9, 0x8b, 0xfb, 0x2f, 0x6d, 0xe9, 0xd4, 0x54, 0xa2, 0x4f, 0x36, 0xeb, 0x65, 0xf7, 0x05, 0xc7, 0x7f, 0xfa, 0xa9, 0x53, 0x49, 0xa0, 0x4c, 0x7f, 0x59, 0x2a, 0x04, 0x61, 0x8a, 0x16, 0x75, 0x91, 0x50, 0xa6, 0xd8, 0xd4, 0xa8, 0x6e, 0x68, 0x2e, 0xd7, 0x45, 0x02, 0x1a, 0x7e, 0x7c, 0x1f, 0xa1, 0x50, 0xbc, 0x2a, 0x15, 0x6f, 0xe3, 0x0e, 0x78, 0x17, 0x56, 0xa7, 0x0d, 0xeb, 0xec, 0xc7, 0x1f, 0x59, 0x49, 0x54, 0x7c, 0xb0, 0xad, 0x87, 0xdd, 0xa4, 0x86, 0xd2, 0x48, 0x00, 0xba, 0x6c, 0x34, 0xb7, 0x8b, 0x7d, 0xb8, 0x12, 0xf1, 0x1c, 0x1a, 0x09, 0x9c, 0x67, 0x1f, 0x2b, 0xef, 0x15, 0xc8, 0xc1, 0x58, 0x5a, 0x72, 0x2a, 0x73, 0x21, 0xcd, 0x24, 0xa5, 0x77, 0x1b, 0xe4, 0xa8, 0xf1, 0x5f, 0x7e, 0x10, 0xf7, 0x60, 0xda, 0x34, 0x00, 0x00 };
-unsigned int script_js_gz_len = 3981;
+static const uint8_t style_css_gz[] PROGMEM = { 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x58, 0x5d, 0x8f, 0xa3, 0x36, 0x14, 0xfd, 0x2b, 0xd1, 0x8e, 0x56, 0x9a, 0x54, 0x18, 0xf1, 0x11, 0x48, 0x06, 0x5e, 0xda, 0x3e, 0x54, 0xda, 0x87, 0xaa, 0x52, 0x57, 0xfb, 0xd0, 0x47, 0x03, 0x26, 0x71, 0x03, 0x36, 0xc2, 0x66, 0x32, 0x59, 0x94, 0xff, 0xde, 0x6b, 0xf3, 0x65, 0x08, 0x99, 0x99, 0x0a, 0x65, 0x36, 0xc0, 0xf5, 0xc7, 0x3d, 0x3e, 0xe7, 0xdc, 0x9b, 0xfd, 0xa5, 0x2d, 0x71, 0x7d, 0xa4, 0x2c, 0x72, 0xe2, 0x0a, 0x67, 0x19, 0x65, 0x47, 0xf8, 0x96, 0xf0, 0x37, 0x24, 0xe8, 0x4f, 0x75, 0x93, 0xf0, 0x3a, 0x23, 0x35, 0x82, 0x27, 0x31, 0xba, 0x90, 0xe4, 0x4c, 0x25, 0x92, 0xb8, 0x42, 0x27, 0x7a, 0x3c, 0x15, 0xf0, 0x91, 0x28, 0xe5, 0x05, 0xaf, 0x23, 0x59, 0x63, 0x26, 0x2a, 0x5c, 0x13, 0x26, 0x6f, 0x09, 0xcf, 0xae, 0x6d, 0x46, 0x45, 0x55, 0xe0, 0x6b, 0x94, 0x17, 0xe4, 0x2d, 0xfe, 0xb7, 0x11, 0x92, 0xe6, 0x57, 0x88, 0x65, 0x12, 0x22, 0xa2, 0x14, 0xfe, 0x90, 0x3a, 0xc6, 0x30, 0x03, 0x43, 0x54, 0x92, 0x52, 0x0c, 0x8f, 0x4a, 0xca, 0xd0, 0x89, 0xa8, 0x89, 0x23, 0xd7, 0x71, 0x5e, 0x4f, 0x71, 0x0e, 0x43, 0x50, 0x8e, 0x4b, 0x5a, 0x5c, 0x23, 0x84, 0xab, 0xaa, 0x20, 0x48, 0x5c, 0x05, 0x0c, 0xb1, 0x7e, 0x2f, 0x28, 0x3b, 0xff, 0x89, 0xd3, 0xef, 0xfa, 0xf6, 0x0f, 0x88, 0xb3, 0xbe, 0x7c, 0x27, 0x47, 0x4e, 0x36, 0x3f, 0xbe, 0x7d, 0xb1, 0xfe, 0xe6, 0x09, 0x97, 0xdc, 0x12, 0xb0, 0x2d, 0x24, 0x48, 0x4d, 0xf3, 0xb8, 0xdb, 0xe8, 0x93, 0xef, 0xfb, 0x71, 0x82, 0xd3, 0xf3, 0xb1, 0xe6, 0x0d, 0xcb, 0x22, 0x98, 0x84, 0xe0, 0x1a, 0x1d, 0x6b, 0x9c, 0x51, 0xd8, 0xc2, 0xb3, 0x7b, 0x70, 0x32, 0x72, 0xb4, 0x9e, 0x72, 0x0f, 0xae, 0xbd, 0xf5, 0x44, 0x0e, 0x70, 0xa5, 0xdb, 0x58, 0xc5, 0x8d, 0x3b, 0xb3, 0x77, 0x37, 0x5b, 0xe5, 0x82, 0xe1, 0x61, 0xdd, 0x5e, 0x68, 0x26, 0x4f, 0x6a, 0xbb, 0x5f, 0xe3, 0x12, 0xbf, 0xa1, 0xee, 0xd6, 0xdf, 0x07, 0xd5, 0x5b, 0xdc, 0x0f, 0x08, 0xc3, 0x3d, 0xdc, 0x18, 0xab, 0x3e, 0xe5, 0x79, 0x1e, 0xf7, 0xd0, 0xaa, 0x95, 0x1b, 0x11, 0xb9, 0xa1, 0x0a, 0x51, 0xc0, 0x9f, 0x70, 0xc6, 0x2f, 0x91, 0xb3, 0xd9, 0x55, 0x6f, 0x1b, 0xcf, 0x81, 0x3f, 0xf5, 0x31, 0xc1, 0xcf, 0x8e, 0xa5, 0x2f, 0xdb, 0xdd, 0x5a, 0xce, 0xe6, 0x00, 0x4f, 0x7d, 0x6f, 0xf9, 0xca, 0x09, 0xb6, 0xf1, 0x0c, 0x77, 0xf5, 0x07, 0x65, 0xb4, 0x26, 0xa9, 0xa4, 0x9c, 0x45, 0x80, 0x40, 0x53, 0xb2, 0x98, 0xbf, 0x92, 0x3a, 0x2f, 0x60, 0x89, 0x13, 0xcd, 0x32, 0xc2, 0x62, 0x7d, 0x76, 0x54, 0x47, 0xe8, 0xaf, 0x39, 0xaf, 0xcb, 0x8d, 0x63, 0xfb, 0x62, 0x43, 0xb0, 0x20, 0x31, 0x66, 0xb4, 0xc4, 0xfd, 0xf8, 0x3e, 0xe5, 0xdf, 0xaa, 0x0a, 0x40, 0x83, 0x98, 0xa0, 0x8b, 0x41, 0xbc, 0x91, 0xb7, 0x5f, 0xcf, 0xe4, 0x9a, 0xd7, 0xb8, 0x24, 0x62, 0xb3, 0x08, 0x6c, 0xf3, 0x9a, 0x97, 0x2d, 0xaf, 0x70, 0x4a, 0xe5, 0x15, 0xe8, 0x35, 0xae, 0xd2, 0xad, 0x57, 0x60, 0x49, 0xfe, 0x79, 0x56, 0x99, 0x6e, 0x6f, 0x92, 0x8f, 0x71, 0xee, 0x7a, 0x9c, 0xb3, 0xbd, 0xdd, 0xec, 0x13, 0xc1, 0x00, 0x5d, 0x3b, 0x30, 0x56, 0x61, 0xb7, 0x71, 0x3a, 0xae, 0x00, 0x6f, 0x49, 0x07, 0xa6, 0xbe, 0xbd, 0x74, 0x27, 0x10, 0x38, 0xce, 0x40, 0x80, 0x20, 0x08, 0x62, 0x49, 0xde, 0x24, 0xd2, 0xf4, 0x1b, 0x88, 0x37, 0xf2, 0x5c, 0x4a, 0x5e, 0x46, 0x2e, 0xcc, 0x27, 0x78, 0x41, 0xb3, 0xcd, 0x53, 0xe6, 0xc2, 0x15, 0x9a, 0x87, 0xa7, 0x31, 0xf7, 0x82, 0xc0, 0x1a, 0x3e, 0x8e, 0xfd, 0xb2, 0xd5, 0x01, 0x59, 0xcd, 0x2b, 0x94, 0xd3, 0x02, 0x26, 0x8c, 0x92, 0xa2, 0xa9, 0x9f, 0x5d, 0x95, 0xd4, 0x28, 0x9c, 0xc7, 0x21, 0x37, 0xfb, 0x42, 0x73, 0x8a, 0x0a, 0x2a, 0x64, 0xab, 0x0e, 0x0d, 0x92, 0x9f, 0xb1, 0xe5, 0x25, 0x4f, 0x80, 0x30, 0xbd, 0x52, 0xd5, 0x88, 0x51, 0xac, 0x40, 0x92, 0xf1, 0x40, 0xd1, 0x35, 0xc2, 0x8d, 0xe4, 0x4b, 0x62, 0x79, 0x9a, 0x58, 0xea, 0x91, 0x91, 0x57, 0x97, 0x84, 0xf3, 0x62, 0xe9, 0x8f, 0xbb, 0x83, 0x24, 0x80, 0x3d, 0x06, 0xff, 0x28, 0x13, 0x44, 0x6e, 0x9c, 0x8d, 0x62, 0xd9, 0xee, 0x8e, 0x69, 0x9e, 0xb9, 0xe5, 0x28, 0x1a, 0x32, 0x14, 0x69, 0xcd, 0x8b, 0x22, 0xc1, 0x83, 0x28, 0x80, 0xa7, 0xef, 0xc7, 0x21, 0x38, 0xd9, 0xf4, 0xdc, 0x1a, 0xc9, 0x9a, 0x4e, 0xf2, 0xc1, 0xd0, 0x53, 0x53, 0x26, 0xed, 0xf2, 0x60, 0x26, 0x9d, 0x2c, 0x70, 0xd8, 0x8d, 0x7b, 0x51, 0x8e, 0xd3, 0x2e, 0xd5, 0xd8, 0x83, 0x7b, 0x30, 0xb0, 0x75, 0x55, 0xde, 0xbd, 0x2e, 0x3f, 0x8b, 0xa8, 0x07, 0x68, 0xaa, 0x8f, 0xaf, 0x10, 0xdd, 0x2f, 0xf4, 0xb8, 0x62, 0x78, 0x69, 0x53, 0x0b, 0x60, 0x65, 0xc5, 0xa9, 0xbe, 0x35, 0xb4, 0x88, 0x8b, 0x02, 0x14, 0xe6, 0x75, 0x0a, 0x33, 0x76, 0x1e, 0x9d, 0xd4, 0x79, 0xb7, 0xab, 0xe2, 0x40, 0xae, 0xe2, 0xdb, 0xcc, 0x45, 0xd4, 0xf9, 0x1d, 0x56, 0x9c, 0xc2, 0xea, 0x0c, 0x46, 0x4b, 0x67, 0xf9, 0xce, 0x5c, 0x0d, 0x83, 0x77, 0xbc, 0x12, 0x63, 0x39, 0x91, 0xe2, 0x82, 0x3c, 0x03, 0xe7, 0x0f, 0xdb, 0x39, 0x49, 0x0f, 0xea, 0x1a, 0x86, 0x82, 0x05, 0x6c, 0xc4, 0xeb, 0xb1, 0xaf, 0x2e, 0xa8, 0xee, 0x8c, 0x53, 0xb1, 0xb5, 0x97, 0xa1, 0xe3, 0xec, 0x31, 0xc0, 0x3e, 0xe0, 0x43, 0x99, 0x76, 0xd8, 0xa4, 0xe0, 0xe9, 0x79, 0x05, 0xa7, 0x61, 0x5a, 0x96, 0xf3, 0x5e, 0x20, 0xfd, 0x13, 0x06, 0x86, 0xd3, 0x8e, 0x53, 0xce, 0x3c, 0x60, 0xbf, 0xe2, 0x01, 0xfd, 0x76, 0x7a, 0x99, 0xab, 0xed, 0x7c, 0x74, 0x40, 0x47, 0x5c, 0x45, 0xe1, 0x48, 0x1d, 0x01, 0xef, 0x71, 0xd1, 0x1a, 0xab, 0xf8, 0x53, 0x4a, 0x61, 0x18, 0xde, 0xec, 0x0a, 0x0b, 0x71, 0x01, 0x6e, 0xa0, 0x92, 0x67, 0x10, 0x59, 0xf1, 0xfe, 0x38, 0x73, 0xfa, 0x46, 0xb2, 0x58, 0xf2, 0x0a, 0x0c, 0xb0, 0x20, 0xb9, 0x84, 0x7f, 0x3a, 0x50, 0x54, 0xb9, 0xd5, 0xbb, 0x71, 0xe2, 0x47, 0x5c, 0x0e, 0x1e, 0xd8, 0x4b, 0xf0, 0xa1, 0xbb, 0xe8, 0x88, 0x21, 0x45, 0xc6, 0x19, 0xf9, 0x1f, 0xb5, 0xd8, 0x74, 0xd7, 0x78, 0xe1, 0xde, 0x5d, 0x4e, 0xfd, 0xc3, 0xa9, 0x58, 0x2c, 0xd3, 0xb7, 0x7b, 0xf6, 0xcc, 0x40, 0x1e, 0x0d, 0xfe, 0x66, 0xeb, 0xa0, 0x61, 0x2b, 0xed, 0x27, 0x0a, 0xe4, 0x7a, 0xad, 0xf5, 0x4c, 0x47, 0xd4, 0x37, 0x33, 0x09, 0xac, 0x57, 0x4b, 0xd7, 0xdb, 0xc6, 0x2b, 0xac, 0x06, 0xac, 0x57, 0x73, 0xed, 0xe4, 0x78, 0x5f, 0x14, 0x75, 0x0a, 0x63, 0x41, 0xf4, 0xa7, 0x82, 0xb8, 0x81, 0x79, 0x2f, 0xb8, 0xce, 0x84, 0x59, 0x19, 0x8d, 0xe8, 0x16, 0x6a, 0xdd, 0x72, 0x7d, 0x77, 0x6b, 0xa0, 0x33, 0xc0, 0xd3, 0x17, 0xbb, 0xfb, 0x9a, 0x35, 0x27, 0xb3, 0xca, 0x7b, 0x18, 0x22, 0xa9, 0x2c, 0x88, 0xc9, 0xd2, 0xc3, 0x42, 0x0b, 0xe1, 0x9d, 0x16, 0x0e, 0xa6, 0x34, 0x9d, 0x61, 0x22, 0xd1, 0x24, 0x77, 0x73, 0xed, 0x1e, 0x31, 0x9e, 0xb2, 0xaa, 0x91, 0x66, 0x3b, 0x34, 0x32, 0xc8, 0x9b, 0x1b, 0x69, 0xe4, 0x4d, 0xf5, 0x95, 0x04, 0x70, 0xe1, 0x35, 0x87, 0xbd, 0x4f, 0x6f, 0x59, 0xe1, 0x1f, 0xb9, 0xe5, 0xa8, 0x09, 0xac, 0x91, 0xc6, 0x2c, 0x25, 0x1d, 0xf9, 0x17, 0xf7, 0xcb, 0xbd, 0x47, 0x39, 0x4f, 0x1b, 0xd1, 0xc2, 0xe1, 0x29, 0x33, 0xea, 0x86, 0xf4, 0x1b, 0x9b, 0xbb, 0xd6, 0x8c, 0x5e, 0xea, 0xf2, 0x27, 0x76, 0xb9, 0x9e, 0xd7, 0x77, 0x05, 0x2e, 0x18, 0x69, 0xd2, 0xc0, 0xee, 0x19, 0x52, 0xb4, 0xae, 0xe6, 0x32, 0x50, 0xc6, 0xe2, 0xea, 0x33, 0xeb, 0x62, 0x86, 0xc2, 0x6f, 0x56, 0x9f, 0x01, 0x2f, 0x73, 0x27, 0x26, 0x44, 0xef, 0x74, 0x3c, 0xea, 0x84, 0x3f, 0x5d, 0x5c, 0xfa, 0x5d, 0xa6, 0x0a, 0x99, 0x62, 0xae, 0x43, 0xdd, 0x07, 0xcf, 0x4d, 0x7b, 0x11, 0xdf, 0x17, 0x24, 0x73, 0x54, 0x77, 0xa8, 0x53, 0x1c, 0x67, 0x0c, 0x7a, 0xd0, 0x59, 0x48, 0x8f, 0x64, 0x3f, 0x71, 0x6e, 0xce, 0xda, 0x45, 0xaf, 0x4c, 0xeb, 0x38, 0x61, 0x98, 0x85, 0x43, 0xe0, 0x3b, 0xa5, 0x29, 0x1c, 0x91, 0x8f, 0x00, 0x73, 0x9c, 0x14, 0x24, 0x9b, 0xfa, 0x4f, 0x3b, 0x18, 0x80, 0x61, 0x5c, 0x29, 0x0a, 0x3a, 0x27, 0xe5, 0xcc, 0xe3, 0x2c, 0x1d, 0x33, 0x84, 0xc4, 0xb2, 0x11, 0x08, 0x44, 0x2b, 0xf0, 0x91, 0xac, 0xf9, 0xb8, 0x66, 0xa4, 0xb6, 0xf2, 0x00, 0xb8, 0xbe, 0x52, 0x8f, 0x9f, 0x11, 0xbc, 0xb0, 0x90, 0x92, 0xc2, 0x76, 0xae, 0x05, 0x6f, 0xf7, 0xa0, 0xa9, 0xb8, 0x73, 0xc0, 0xc5, 0xef, 0x01, 0xf7, 0xde, 0xc6, 0x3e, 0x67, 0x58, 0xf7, 0xee, 0xb1, 0x2c, 0x8d, 0x3f, 0x41, 0x03, 0x99, 0x62, 0xa0, 0x96, 0xff, 0x3c, 0x7d, 0xfb, 0x0e, 0xea, 0x45, 0x92, 0x8e, 0x69, 0x5c, 0xcb, 0xc1, 0xa4, 0xae, 0x79, 0xbd, 0x70, 0x77, 0x3f, 0xf1, 0x9d, 0xd9, 0xe1, 0x2f, 0xc6, 0x88, 0x26, 0x4d, 0xe1, 0xeb, 0x6c, 0x94, 0xbf, 0x4b, 0xf7, 0xc1, 0xcb, 0xbb, 0xa3, 0x80, 0x91, 0x0c, 0x50, 0xfe, 0x88, 0x69, 0x2a, 0x0e, 0xf5, 0xb2, 0xeb, 0x1b, 0x3f, 0xfd, 0x4b, 0x4b, 0xb7, 0xcf, 0x9d, 0x81, 0x05, 0xe1, 0xf4, 0xfb, 0x2d, 0xb8, 0xef, 0x01, 0xbd, 0xc3, 0xe2, 0xb8, 0x46, 0x67, 0x98, 0x04, 0x3b, 0xad, 0xf8, 0x6e, 0x4b, 0x36, 0x19, 0x86, 0xbf, 0xd6, 0x95, 0x4d, 0xaf, 0xbd, 0x8f, 0xdb, 0xc9, 0x07, 0xd5, 0xfd, 0xd3, 0x46, 0xa0, 0x80, 0xe9, 0x70, 0xd1, 0xdd, 0x5b, 0x07, 0x85, 0x57, 0x93, 0x72, 0x80, 0x42, 0x21, 0x34, 0xc3, 0xef, 0xdd, 0x76, 0xd4, 0xbb, 0x6b, 0x47, 0x97, 0x24, 0x9e, 0xb2, 0xdb, 0x0d, 0x3f, 0x6c, 0xbd, 0xdd, 0x7a, 0xf2, 0xf3, 0x65, 0x1f, 0x8b, 0x7f, 0x11, 0x69, 0x17, 0x1c, 0x2b, 0xe5, 0xb5, 0x2b, 0xa2, 0x9f, 0x3c, 0x21, 0x8c, 0x7b, 0x70, 0x10, 0x79, 0x05, 0xcc, 0x44, 0x5f, 0x2f, 0xc6, 0x32, 0x5f, 0x35, 0x85, 0x20, 0x1b, 0x57, 0xfd, 0xe2, 0x85, 0x26, 0x94, 0x32, 0x40, 0xdd, 0xac, 0xeb, 0xfa, 0x75, 0xeb, 0x7c, 0x5d, 0xa9, 0xe8, 0xb7, 0x60, 0xe5, 0xb1, 0x6e, 0x34, 0x6e, 0xca, 0x19, 0xd6, 0x46, 0xdc, 0x46, 0x22, 0x5b, 0x9d, 0x78, 0x2c, 0x9b, 0x71, 0xc4, 0x88, 0x84, 0x52, 0x75, 0x16, 0xed, 0xac, 0xd3, 0xb9, 0x17, 0xf6, 0x54, 0x9b, 0xcd, 0xfa, 0x10, 0xa8, 0x4a, 0x33, 0xea, 0x63, 0x4a, 0x2c, 0x87, 0xe6, 0xe2, 0x1b, 0xfb, 0x0b, 0xfa, 0x95, 0x87, 0xc9, 0x8d, 0x21, 0x90, 0xa0, 0xa5, 0xf7, 0x6c, 0x78, 0xa9, 0x4e, 0xcf, 0x6c, 0x5a, 0x3a, 0xb5, 0x8f, 0xdc, 0x57, 0x42, 0xbf, 0xcd, 0xb6, 0xdf, 0xbf, 0x52, 0xff, 0xb1, 0xf2, 0xe2, 0xdf, 0xfe, 0x03, 0xd8, 0x12, 0xa3, 0x08, 0x81, 0x12, 0x00, 0x00 };
 
-const uint8_t style_css_gz[] PROGMEM= { 0x1f, 0x8b, 0x08, 0x08, 0x13, 0x89, 0x91, 0x67, 0x02, 0xff, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x73, 0x73, 0x00, 0xbd, 0x59, 0xeb, 0x6e, 0xdb, 0x36, 0x14, 0xfe, 0x3f, 0xa0, 0xef, 0x40, 0xb4, 0x28, 0x10, 0x17, 0x66, 0x2a, 0xc9, 0x96, 0xe3, 0xb8, 0x18, 0xb0, 0x75, 0x5b, 0xb1, 0x00, 0x2d, 0x36, 0x34, 0x18, 0x86, 0xfd, 0xa4, 0x25, 0xca, 0xe6, 0x22, 0x93, 0x82, 0x28, 0xe5, 0xd2, 0xa2, 0x8f, 0xb5, 0x27, 0xd8, 0x8b, 0xed, 0x90, 0x22, 0x25, 0xea, 0xea, 0xb4, 0x88, 0x17, 0x25, 0xb2, 0x43, 0x1d, 0x1e, 0x92, 0xe7, 0xf2, 0x9d, 0x8f, 0xd4, 0xeb, 0x57, 0xdf, 0x3f, 0xd9, 0xcf, 0xb3, 0xef, 0x10, 0xfa, 0x48, 0x25, 0x2d, 0x10, 0xe1, 0x31, 0x7a, 0x4b, 0x24, 0x45, 0x3f, 0x09, 0x9e, 0xb0, 0x5d, 0x99, 0x93, 0x82, 0x09, 0x2e, 0x95, 0xc0, 0xd3, 0x0d, 0x87, 0x5e, 0xbd, 0x56, 0x0a, 0x5f, 0xa1, 0xcf, 0xea, 0x03, 0xa1, 0x03, 0xc9, 0x77, 0x8c, 0x6f, 0x90, 0xf7, 0xa6, 0xfa, 0x3f, 0x23, 0x71, 0xcc, 0xf8, 0xae, 0x69, 0xd8, 0x8a, 0x7b, 0x2c, 0xd9, 0x27, 0xdd, 0xb6, 0x15, 0x79, 0x4c, 0x73, 0x0c, 0x4d, 0xe6, 0x21, 0xbe, 0xa3, 0xdb, 0x1b, 0x56, 0xe0, 0x82, 0x64, 0x78, 0xcf, 0x76, 0xfb, 0x14, 0xfe, 0x0a, 0x1c, 0x89, 0x54, 0xe4, 0x1b, 0x54, 0xe4, 0x84, 0xcb, 0x8c, 0xe4, 0x94, 0x17, 0x5a, 0xfc, 0x8b, 0xba, 0xa9, 0xbf, 0xad, 0x88, 0x1f, 0xec, 0xf8, 0x31, 0x93, 0x59, 0x4a, 0x1e, 0x36, 0x28, 0x49, 0xa9, 0xd5, 0xfa, 0x77, 0x29, 0x0b, 0x96, 0x3c, 0x80, 0x1e, 0x5e, 0x40, 0xe7, 0x0d, 0x8a, 0xe0, 0x4e, 0x73, 0xf3, 0x94, 0xc0, 0x20, 0x1c, 0xb3, 0x82, 0x1e, 0x64, 0xe7, 0xc9, 0x81, 0x71, 0xbc, 0xa7, 0x6a, 0x0a, 0x1b, 0xe4, 0x7b, 0xde, 0xed, 0xde, 0xb4, 0x27, 0xa0, 0x07, 0x27, 0xe4, 0xc0, 0x52, 0x18, 0x07, 0x93, 0x2c, 0x4b, 0x29, 0x96, 0x0f, 0x12, 0x34, 0xcc, 0xd1, 0xdb, 0x94, 0xf1, 0x9b, 0x0f, 0x24, 0xba, 0xd6, 0xff, 0xbf, 0x03, 0xc9, 0x39, 0x7a, 0x7e, 0x4d, 0x77, 0x82, 0xa2, 0x3f, 0xae, 0x9e, 0xcf, 0xd1, 0x47, 0xb1, 0x15, 0x85, 0x98, 0x23, 0x09, 0x6b, 0xc1, 0x92, 0xe6, 0x2c, 0x31, 0x4a, 0xcd, 0x22, 0x5f, 0x2c, 0x16, 0x0b, 0x6b, 0x29, 0x12, 0xdd, 0xec, 0x72, 0x51, 0xf2, 0x78, 0x83, 0x40, 0x2b, 0x25, 0x39, 0xde, 0xe5, 0x24, 0x66, 0x30, 0xc5, 0x33, 0x7f, 0xed, 0xc5, 0x74, 0x37, 0x47, 0x2f, 0x92, 0x00, 0xae, 0x0b, 0xf8, 0x42, 0xd7, 0x70, 0x45, 0x33, 0xd3, 0x57, 0xc9, 0x37, 0x73, 0x3f, 0x5f, 0x5a, 0x83, 0xbd, 0x7e, 0xe2, 0x48, 0xfb, 0x40, 0x18, 0x57, 0xf1, 0x55, 0xc0, 0x27, 0xcd, 0x11, 0x46, 0xd7, 0xec, 0x50, 0xa6, 0x10, 0x68, 0x7c, 0x87, 0x3e, 0x88, 0x2d, 0x4b, 0x29, 0xfa, 0x99, 0xde, 0xb2, 0x88, 0x9e, 0x20, 0xea, 0xce, 0xa3, 0x7a, 0x5c, 0xed, 0xfc, 0x3b, 0x16, 0x17, 0x7b, 0xed, 0xa9, 0x97, 0x7a, 0xb9, 0x07, 0x72, 0x8f, 0x4d, 0xdb, 0xe2, 0x22, 0xcc, 0xaa, 0x68, 0xb0, 0x36, 0x59, 0xad, 0x2e, 0x4c, 0x8b, 0x6b, 0xe6, 0x17, 0x49, 0x52, 0xf9, 0xc3, 0x44, 0xa6, 0x32, 0x77, 0x09, 0x61, 0xe1, 0xaf, 0xac, 0xb0, 0x8a, 0xde, 0x3d, 0x89, 0xc5, 0xdd, 0x06, 0x55, 0x96, 0xf6, 0xd0, 0x32, 0xbb, 0x47, 0x81, 0x07, 0xb7, 0x7c, 0xb7, 0x25, 0x67, 0xde, 0x1c, 0x99, 0xdf, 0x73, 0x7f, 0x36, 0xb7, 0x32, 0x6b, 0x78, 0xbc, 0x08, 0x06, 0x64, 0xbc, 0xb0, 0x72, 0x59, 0x3f, 0x6e, 0xd5, 0x17, 0x1c, 0xb3, 0x9c, 0x46, 0x2a, 0x6d, 0x37, 0x2a, 0x40, 0xca, 0x03, 0xd7, 0x8f, 0xc4, 0x2d, 0xcd, 0x93, 0x54, 0xcd, 0x61, 0xcf, 0xe2, 0x98, 0x56, 0x8d, 0x3a, 0x3d, 0x58, 0x25, 0xab, 0xbf, 0x27, 0x22, 0x3f, 0xc0, 0x08, 0x0b, 0x89, 0x28, 0xa0, 0x80, 0x96, 0x21, 0x9c, 0x1d, 0x88, 0x55, 0x67, 0x8c, 0xf7, 0x63, 0x96, 0x41, 0x68, 0x81, 0x60, 0x58, 0x09, 0x62, 0x51, 0xaa, 0xfc, 0x82, 0x60, 0x79, 0xf6, 0xdd, 0x0f, 0x37, 0xf4, 0x21, 0xc9, 0xc9, 0x81, 0xca, 0x9e, 0xbc, 0x36, 0x79, 0x92, 0x8b, 0x83, 0xcd, 0x3c, 0x91, 0x91, 0x88, 0x15, 0x0f, 0x4d, 0xa6, 0xd7, 0x93, 0x30, 0xf3, 0x81, 0xb0, 0xa0, 0x7f, 0x9d, 0x29, 0x4b, 0xcd, 0x9a, 0xfc, 0x2d, 0x44, 0xaf, 0xbf, 0x3f, 0xd9, 0xdf, 0xab, 0x3b, 0x9f, 0x20, 0x9c, 0x7f, 0xa5, 0x04, 0xdc, 0x7e, 0x8a, 0x58, 0xdd, 0x6b, 0xcd, 0xd5, 0x5a, 0x6b, 0x4c, 0x54, 0x61, 0x65, 0xcc, 0xa5, 0x31, 0x05, 0x70, 0x91, 0x3a, 0xc1, 0xa6, 0xdb, 0xee, 0x4c, 0xc0, 0x86, 0x5e, 0x25, 0x68, 0x71, 0x22, 0x0c, 0xc3, 0xca, 0xed, 0xf4, 0xbe, 0xc0, 0x1a, 0xc3, 0x5a, 0xe8, 0x55, 0x43, 0x6b, 0x51, 0x08, 0x30, 0xa0, 0x0f, 0x03, 0x49, 0x91, 0xb2, 0x18, 0xbd, 0x88, 0x7d, 0xb8, 0x56, 0xbd, 0xd0, 0xd7, 0x81, 0x19, 0x84, 0xe1, 0x1c, 0x35, 0x37, 0xef, 0xfc, 0x72, 0x56, 0x0b, 0xc6, 0xb9, 0xc8, 0x70, 0xc2, 0x52, 0x18, 0x01, 0x90, 0x3b, 0x2d, 0xf3, 0x33, 0xbf, 0x76, 0xa5, 0xc5, 0xed, 0x69, 0xb9, 0x13, 0x38, 0xec, 0x4f, 0xf6, 0x8e, 0xe1, 0xf7, 0x4c, 0x16, 0xa7, 0xf0, 0xd9, 0x1d, 0x4b, 0x18, 0x4e, 0x41, 0xb9, 0x09, 0x76, 0x48, 0x48, 0x1b, 0x9d, 0x6d, 0xd0, 0xb8, 0x4c, 0xb6, 0x06, 0x37, 0x6c, 0xf9, 0x53, 0x4b, 0x7e, 0xd3, 0xf2, 0xf5, 0xd2, 0x34, 0xd8, 0xdc, 0xc5, 0x10, 0xe9, 0xa4, 0x2c, 0xc4, 0x20, 0xdc, 0x04, 0x35, 0xdc, 0xa8, 0x76, 0xd7, 0x7d, 0x95, 0x9b, 0xbc, 0x4b, 0xf0, 0x90, 0xbe, 0xf9, 0x4b, 0xe5, 0x26, 0x03, 0x22, 0x2e, 0x3a, 0x31, 0xae, 0x38, 0x80, 0x87, 0x14, 0xe8, 0x2c, 0x87, 0x80, 0x27, 0x98, 0xd9, 0x2c, 0x6f, 0x16, 0xba, 0xd9, 0x58, 0x4f, 0xca, 0x28, 0x17, 0x69, 0xba, 0x25, 0x6d, 0x6c, 0x5d, 0xeb, 0x79, 0x1d, 0xef, 0x84, 0x21, 0x61, 0xa3, 0x9b, 0xaa, 0xab, 0x6b, 0xaa, 0x76, 0x09, 0x7f, 0x8c, 0x9e, 0x7d, 0x79, 0xd8, 0xf6, 0xf5, 0xf4, 0x91, 0x76, 0xc8, 0x8c, 0xcb, 0x66, 0xb6, 0xaf, 0x5f, 0xa1, 0x2b, 0xa8, 0xc7, 0x3a, 0x5e, 0x1c, 0xe7, 0xaa, 0xaa, 0xdf, 0xd7, 0x5e, 0x57, 0x01, 0xeb, 0xcd, 0x75, 0xd7, 0x99, 0xbe, 0xb2, 0xa8, 0x53, 0x14, 0xbe, 0xce, 0x7b, 0x81, 0x72, 0x9c, 0xbe, 0x2d, 0xb4, 0xf7, 0x2e, 0xc6, 0x4a, 0xc0, 0x18, 0x35, 0x89, 0xca, 0x5c, 0x2a, 0x10, 0xc8, 0x04, 0xab, 0xdb, 0x5c, 0xf8, 0x27, 0x69, 0x0a, 0x6a, 0x83, 0x1a, 0xf8, 0x1d, 0x43, 0x2b, 0x65, 0x9b, 0xbd, 0x0a, 0xc2, 0x6a, 0xdd, 0xc3, 0x20, 0x8b, 0x7d, 0x9b, 0xd9, 0x43, 0x05, 0x4f, 0x85, 0xd4, 0x7a, 0xb8, 0x96, 0xcd, 0xdd, 0xa2, 0xa8, 0xe1, 0x6d, 0xb8, 0xe0, 0x75, 0x67, 0x44, 0xa0, 0xc8, 0xdd, 0xd2, 0xde, 0x94, 0x64, 0x44, 0x52, 0x7a, 0x06, 0x30, 0xb4, 0x9e, 0x0d, 0xa4, 0xdd, 0x5a, 0x5d, 0x1d, 0x65, 0x50, 0xa6, 0x90, 0xbc, 0xdd, 0x7d, 0x6e, 0xdc, 0x87, 0x73, 0xc3, 0x82, 0x6c, 0x06, 0x5a, 0x04, 0xf5, 0xbc, 0x0b, 0x62, 0x1c, 0x5d, 0x9b, 0x9e, 0x71, 0xcd, 0x9c, 0xb6, 0xa9, 0x88, 0x6e, 0x26, 0x5c, 0xe0, 0x8e, 0xc8, 0x13, 0xd1, 0xc5, 0x07, 0xe7, 0x31, 0x87, 0xe2, 0x59, 0x3d, 0x6e, 0x86, 0xed, 0x23, 0xfe, 0xc5, 0x14, 0xe2, 0x9b, 0x65, 0x58, 0x28, 0xb7, 0xcb, 0x78, 0x7c, 0xb8, 0xec, 0x48, 0x06, 0x84, 0xa7, 0x9b, 0xba, 0x12, 0x84, 0x49, 0x6a, 0xa6, 0xee, 0xcc, 0x65, 0xd1, 0x31, 0xd3, 0x6a, 0xb5, 0x3a, 0x0d, 0x76, 0xff, 0x4e, 0xa4, 0xbc, 0x83, 0x14, 0x01, 0xa2, 0x18, 0x93, 0xf4, 0x14, 0x00, 0x9e, 0x99, 0x11, 0xf0, 0x41, 0x8d, 0x60, 0x8a, 0xaf, 0xb0, 0x59, 0x92, 0xb0, 0x7b, 0x1a, 0x57, 0xb9, 0x23, 0x32, 0x4b, 0x5b, 0x52, 0x9a, 0x14, 0xf6, 0xbb, 0x09, 0x1c, 0xcf, 0x24, 0x42, 0x65, 0x7e, 0xef, 0xcd, 0x31, 0x30, 0x0a, 0xa7, 0x6a, 0x66, 0xf8, 0xb8, 0x92, 0x59, 0x8b, 0xd5, 0x5e, 0xe6, 0x82, 0x57, 0x1c, 0x6e, 0x6a, 0x37, 0x33, 0x16, 0x01, 0x2d, 0xc6, 0x51, 0x95, 0xa1, 0x36, 0x5b, 0x73, 0xd1, 0xc3, 0x3c, 0x6a, 0x51, 0xc7, 0x2a, 0x6e, 0xda, 0xf6, 0x3c, 0x77, 0x93, 0xb6, 0x1f, 0x8d, 0x2d, 0x3e, 0x57, 0xf5, 0xd7, 0xdd, 0xec, 0xc4, 0x27, 0x70, 0x77, 0x8c, 0x7d, 0x4f, 0x31, 0xfc, 0xa0, 0x57, 0x71, 0xeb, 0x16, 0x17, 0xc3, 0x26, 0xa8, 0xb8, 0x1f, 0xcc, 0xde, 0x8c, 0xe1, 0x8f, 0xf1, 0xe9, 0x84, 0xd5, 0x2a, 0xcc, 0x1d, 0x21, 0xdb, 0x7a, 0xe1, 0x35, 0xd1, 0x5e, 0x34, 0x44, 0x1b, 0x32, 0x2f, 0xbf, 0x23, 0x79, 0x2c, 0x07, 0x18, 0xb7, 0xdb, 0xe9, 0x73, 0x9b, 0x2b, 0xf7, 0xa6, 0xe8, 0xdb, 0x8d, 0x5f, 0x87, 0x45, 0x7f, 0x69, 0x9b, 0xde, 0x65, 0xa1, 0x23, 0xc4, 0xb1, 0x83, 0x36, 0xc6, 0x88, 0xae, 0x92, 0x82, 0x15, 0x29, 0xed, 0xe3, 0xc6, 0x7a, 0x08, 0xc3, 0x56, 0xc3, 0x18, 0xb6, 0xee, 0x41, 0xb1, 0xd7, 0x19, 0x44, 0x96, 0xdb, 0x91, 0x71, 0x96, 0xff, 0x17, 0x3e, 0x5d, 0xf1, 0xac, 0x2c, 0xc0, 0x55, 0xe8, 0xad, 0x28, 0xfe, 0xfd, 0x87, 0xca, 0x93, 0x22, 0x14, 0x53, 0x83, 0x0d, 0xef, 0x63, 0x9b, 0xe4, 0x0d, 0xfa, 0xac, 0x63, 0xa3, 0xab, 0xb1, 0xa1, 0xf6, 0x34, 0x84, 0x8b, 0x4c, 0x72, 0x92, 0x61, 0xf7, 0x0e, 0xef, 0x3f, 0xa6, 0x28, 0x45, 0x03, 0x60, 0x44, 0x47, 0x28, 0xe1, 0x11, 0x75, 0x40, 0x6a, 0xa0, 0xb1, 0x03, 0x21, 0x7a, 0xc1, 0x9b, 0x44, 0x44, 0xa5, 0xac, 0x96, 0x0d, 0xd9, 0xa0, 0x6a, 0xaf, 0xa3, 0xc4, 0xac, 0x61, 0xa0, 0x5e, 0xb7, 0x33, 0x5a, 0x5d, 0x0b, 0x27, 0xa1, 0xfd, 0x20, 0xa8, 0x37, 0x30, 0x7e, 0xc3, 0x36, 0xb6, 0x25, 0xac, 0x99, 0x63, 0x85, 0x36, 0xd9, 0x18, 0x68, 0xe9, 0x52, 0xe9, 0xbb, 0x31, 0x5f, 0xf5, 0xea, 0xef, 0x00, 0x5a, 0x5c, 0xb0, 0xe5, 0x90, 0xee, 0xfc, 0x7b, 0x3e, 0x38, 0xba, 0xd7, 0xb3, 0x59, 0xf3, 0x6d, 0x3c, 0xcf, 0xac, 0x33, 0x52, 0xd6, 0x4f, 0x87, 0x50, 0x56, 0x1f, 0x19, 0x0d, 0x53, 0xa1, 0x01, 0x0d, 0x2e, 0x5b, 0x6c, 0xe9, 0xa9, 0xa3, 0xad, 0xdd, 0x49, 0x70, 0x4e, 0xa3, 0x21, 0x74, 0x77, 0xfc, 0x67, 0xc7, 0x4d, 0x06, 0x06, 0xad, 0xfa, 0x8f, 0x8e, 0xea, 0x79, 0xab, 0x55, 0xbc, 0xea, 0xf4, 0x3a, 0xca, 0x1f, 0x57, 0xdd, 0x30, 0xd8, 0x80, 0xef, 0xc9, 0x36, 0xa5, 0xb1, 0x09, 0xbe, 0x1a, 0xd8, 0xcf, 0xc3, 0x96, 0xe9, 0xb9, 0x50, 0x20, 0x09, 0xfb, 0x35, 0x4b, 0x15, 0x1a, 0xe5, 0x36, 0xae, 0xd5, 0x21, 0xe4, 0x93, 0x9f, 0xab, 0x51, 0x2e, 0xc9, 0x0e, 0x6e, 0x28, 0xa6, 0xe8, 0xba, 0x20, 0x45, 0x79, 0x12, 0xf8, 0x91, 0x5a, 0x33, 0x86, 0x6a, 0xa3, 0x46, 0x3b, 0x42, 0x90, 0x6a, 0xac, 0xa8, 0x38, 0x52, 0x68, 0xe0, 0x69, 0x68, 0x07, 0x71, 0x86, 0xe1, 0xe9, 0x1c, 0x61, 0x85, 0x61, 0xb3, 0x01, 0x10, 0x0b, 0x96, 0xc7, 0xb6, 0x4e, 0xc3, 0xb4, 0xc0, 0xcd, 0x7a, 0xbd, 0xc3, 0x18, 0xac, 0xe3, 0xdf, 0x52, 0xac, 0x47, 0xaa, 0xe1, 0x20, 0x21, 0xff, 0x04, 0xe0, 0x15, 0x6b, 0x24, 0x70, 0xeb, 0x56, 0xdb, 0x96, 0xe7, 0x23, 0x11, 0xd9, 0x35, 0x91, 0x37, 0x1b, 0x23, 0x4b, 0x1d, 0x7d, 0x34, 0xcf, 0x45, 0x3e, 0xc8, 0x99, 0x16, 0xdb, 0x85, 0x37, 0x9a, 0x55, 0x1d, 0x2d, 0xb2, 0x8c, 0x22, 0xf8, 0x3a, 0xa0, 0x67, 0xb1, 0x8c, 0x2e, 0xc2, 0xcb, 0x47, 0xeb, 0x01, 0x6c, 0xe0, 0xea, 0x90, 0xf7, 0x6b, 0xd3, 0xfc, 0xa9, 0x13, 0xe5, 0x1a, 0x26, 0x82, 0xde, 0xea, 0x94, 0x3e, 0x49, 0x82, 0x80, 0x7a, 0xec, 0x96, 0x00, 0x7b, 0x24, 0xa0, 0x0f, 0x7c, 0xeb, 0xf3, 0x1b, 0x53, 0xb2, 0xc3, 0x55, 0xe7, 0x94, 0x39, 0x1c, 0x39, 0x22, 0x08, 0xd6, 0x43, 0x71, 0xde, 0x2a, 0x70, 0x9d, 0x5a, 0xd2, 0x36, 0xe5, 0xe3, 0xf6, 0xe5, 0x6e, 0x1d, 0x5c, 0x4c, 0x6c, 0xcd, 0x5d, 0xb9, 0xe0, 0x6b, 0xcf, 0x22, 0xa6, 0xb6, 0x23, 0xdf, 0x56, 0xbf, 0x94, 0xcd, 0x8d, 0xc9, 0x61, 0x27, 0xdf, 0xe2, 0x44, 0x41, 0x4e, 0x0f, 0x2d, 0x03, 0x1b, 0x0f, 0x34, 0x1d, 0x8d, 0xb3, 0x1e, 0x71, 0xc4, 0x11, 0x4c, 0x1d, 0x71, 0xf4, 0xc0, 0xc5, 0xb5, 0xd1, 0xb2, 0x7d, 0xae, 0x1f, 0x2c, 0xa7, 0x6c, 0xd9, 0x9f, 0xda, 0xb1, 0x5a, 0x35, 0xdc, 0xed, 0x3c, 0x15, 0x24, 0xae, 0x33, 0x6e, 0xac, 0x3c, 0x39, 0x75, 0xac, 0x3a, 0xe2, 0x35, 0xa6, 0xc7, 0xf4, 0x16, 0xdc, 0x22, 0x5d, 0x86, 0xd6, 0xec, 0x4e, 0xb2, 0x32, 0x95, 0x14, 0xf9, 0xea, 0x05, 0x00, 0xe3, 0x09, 0xe3, 0xe0, 0xe4, 0x81, 0xed, 0x48, 0x25, 0xa5, 0x47, 0xf7, 0x5e, 0x1e, 0xdb, 0x88, 0xe8, 0xb3, 0xfd, 0x70, 0x42, 0xae, 0xd9, 0x53, 0x69, 0x51, 0x55, 0x28, 0x1e, 0xa1, 0xf3, 0x24, 0x10, 0xf2, 0xde, 0x18, 0x56, 0xbd, 0x2f, 0xfd, 0x45, 0xa3, 0xac, 0x2a, 0xb8, 0xa7, 0xe1, 0xfb, 0x16, 0x37, 0xe7, 0xa8, 0x02, 0x74, 0xf8, 0xe4, 0x02, 0x73, 0x5a, 0x00, 0x27, 0xbe, 0x91, 0x9d, 0xd7, 0x03, 0x75, 0xc1, 0x1d, 0x29, 0x4e, 0xed, 0x1d, 0x50, 0x9b, 0x57, 0x86, 0x0e, 0x85, 0x6d, 0x83, 0xb5, 0xe3, 0xf8, 0x04, 0x76, 0x83, 0x57, 0xfc, 0x37, 0xd8, 0x78, 0x1c, 0x73, 0x7e, 0x23, 0x69, 0x02, 0x60, 0x6e, 0x5c, 0xd6, 0x66, 0x4e, 0x8e, 0xdf, 0xdd, 0x92, 0xd6, 0x6c, 0x43, 0x9d, 0x2a, 0xd6, 0x20, 0x9a, 0x29, 0x60, 0x95, 0x44, 0xcf, 0x1c, 0x56, 0x4e, 0xbd, 0xdf, 0xbc, 0x54, 0xef, 0x46, 0xbf, 0xfc, 0x07, 0x76, 0xe3, 0x6a, 0x53, 0x2f, 0x1f, 0x00, 0x00 };
-unsigned int style_css_gz_len = 1892;
+static constexpr StaticAsset FRONTEND_ASSETS[] = {
+  { "/", "text/html", index_htm_gz, sizeof(index_htm_gz), "\"f473f6e60d968af0\"" },
+  { "/script.js", "text/javascript", script_js_gz, sizeof(script_js_gz), "\"c24a30ed4ee8c439\"" },
+  { "/style.css", "text/css", style_css_gz, sizeof(style_css_gz), "\"eaa0a673c5387ab5\"" },
+};
 
+};
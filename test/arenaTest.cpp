@@ -0,0 +1,58 @@
+//Portal restarts with EASYWIFI_STATIC_ARENA, server and DNS live inside EasyWifi
+
+#include "simulation.h"
+
+using namespace EASYWIFI;
+using namespace testing;
+
+TEST(portalRestartAllocatesNothing)
+{
+  EasyWifi wifi;
+  wifi.setup(); //First start builds the server in the arena
+  wifi.logoutCaptivePortal();
+  wifi.startCaptivePortal();
+
+  fake::HeapStats before = fake::heap();
+  const int cycles = 10000;
+  for(int i = 0; i < cycles; i++)
+  {
+    wifi.logoutCaptivePortal();
+    CHECK(AsyncWebServer::running() == nullptr);
+    wifi.startCaptivePortal();
+  }
+
+  CHECK_EQ(fake::heap().allocations - before.allocations, 0);
+  CHECK_EQ(fake::heap().liveBytes, before.liveBytes);
+}
+
+TEST(restartedPortalServesEveryRoute)
+{
+  addAccessPoint("home", 1, 6, -50, "homepass1");
+
+  EasyWifi wifi;
+  wifi.setup();
+  for(int i = 0; i < 3; i++)
+  {
+    wifi.logoutCaptivePortal();
+    wifi.startCaptivePortal();
+  }
+
+  AsyncWebServerRequest probe(HTTP_GET, "/generate_204");
+  CHECK_EQ(handle(probe)->code(), 302);
+  AsyncWebServerRequest page(HTTP_GET, "/");
+  CHECK_EQ(handle(page)->code(), 200);
+
+  //Events handler is kept with the server, it must still push
+  AsyncEventSource *events = AsyncWebServer::running()->eventSource("/events");
+  if(!CHECK(events != nullptr))
+    return;
+  events->connectClient();
+  CHECK(runUntil(wifi, [&wifi]{ return wifi.get_ScanState() == SCAN_STATUS::FINISHED; }, 10000));
+  CHECK(!events->sent().empty());
+  CHECK_STR(events->sent().back().data.c_str(), "FINISHED");
+
+  AsyncWebServerRequest scan(HTTP_GET, "/scan-status");
+  AsyncWebServerResponse *response = handle(scan);
+  CHECK_EQ(response->code(), 200);
+  CHECK(response->body().find("\"home\"") != std::string::npos);
+}
@@ -0,0 +1,141 @@
+//Numbers to compare between commits: update() latency, heap per request, time to portal.
+//Clock is simulated, so only the durations measured with steady_clock depend on the host
+
+#include "simulation.h"
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace EASYWIFI;
+using namespace testing;
+
+typedef std::chrono::steady_clock Clock;
+
+static long long elapsedNanos(Clock::time_point start)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+}
+
+static void addNeighbourhood(uint8_t count)
+{
+  char ssid[SSID_MAX_LENGTH + 1];
+  for(uint8_t i = 0; i < count; i++)
+  {
+    snprintf(ssid, sizeof(ssid), "neighbour-%02u", i);
+    addAccessPoint(ssid, 100 + i, 1 + i % 13, -45 - i, i % 3 ? "secret123" : "");
+  }
+}
+
+TEST(updateLatencyPercentiles)
+{
+  addNeighbourhood(40);
+  addAccessPoint("home", 1, 6, -60, "homepass1");
+
+  //Portal first with stored networks: scan, a phone polling, the connection and the portal closing all overlap
+  EasyWifi wifi;
+  wifi.addCredential("office", "officepass");
+  wifi.addCredential("home", "homepass1");
+  wifi.set_PortalFirst(true);
+  wifi.setup();
+
+  std::vector<long long> samples;
+  for(int i = 0; i < 6000; i++)
+  {
+    fake::advance(10);
+    if(i % 50 == 0) //Phone polls every 500 ms while the portal is up
+    {
+      AsyncWebServerRequest poll(HTTP_GET, "/scan-status");
+      if(handle(poll))
+        poll.response()->body();
+    }
+
+    Clock::time_point start = Clock::now();
+    wifi.update();
+    samples.push_back(elapsedNanos(start));
+  }
+  CHECK(wifi.get_WifiState() == WIFI_STATUS::CONNECTED);
+  CHECK(AsyncWebServer::running() == nullptr);
+  CHECK_EQ(fake::delayCalls(), 0);
+
+  std::sort(samples.begin(), samples.end());
+  auto percentile = [&samples](double p){ return samples[(size_t)(p * (samples.size() - 1))]; };
+  CHECK(samples.back() < 5000000); //5 ms, a pass that long would stall the portal on the device
+  report("update() over %u calls: p50 %lld ns, p90 %lld ns, p99 %lld ns, max %lld ns",
+    (unsigned)samples.size(), percentile(0.5), percentile(0.9), percentile(0.99), samples.back());
+}
+
+//Library allocations while handling one request, fake server and responses excluded
+static uint64_t allocationsOf(AsyncWebServerRequest &request, uint64_t *bytes = nullptr)
+{
+  fake::HeapStats before = fake::heap();
+  if(handle(request))
+    request.response()->body();
+  if(bytes)
+    *bytes = fake::heap().allocatedBytes - before.allocatedBytes;
+  return fake::heap().allocations - before.allocations;
+}
+
+TEST(heapAllocationsPerRequest)
+{
+  addNeighbourhood(20);
+  EasyWifi wifi;
+  wifi.setup();
+  CHECK(runUntil(wifi, [&wifi]{ return wifi.get_ScanState() == SCAN_STATUS::FINISHED; }, 10000));
+
+  AsyncWebServerRequest page(HTTP_GET, "/");
+  AsyncWebServerRequest probe(HTTP_GET, "/generate_204", "connectivitycheck.gstatic.com");
+  AsyncWebServerRequest scan(HTTP_GET, "/scan-status");
+  AsyncWebServerRequest delta(HTTP_GET, "/scan-status");
+  delta.withParam("since", "1");
+  AsyncWebServerRequest startScan(HTTP_GET, "/start-scan");
+  AsyncWebServerRequest status(HTTP_GET, "/wifi-status");
+
+  uint64_t pageAllocations = allocationsOf(page);
+  uint64_t probeAllocations = allocationsOf(probe);
+  uint64_t scanBytes = 0;
+  uint64_t scanAllocations = allocationsOf(scan, &scanBytes);
+  uint64_t deltaAllocations = allocationsOf(delta);
+  uint64_t startScanAllocations = allocationsOf(startScan);
+  uint64_t statusAllocations = allocationsOf(status);
+
+  CHECK_EQ(pageAllocations, 0);
+  CHECK_EQ(probeAllocations, 0);
+  CHECK_EQ(startScanAllocations, 0);
+  CHECK_EQ(statusAllocations, 0);
+  CHECK(scanAllocations <= 1); //Only the filler, the scan itself is held in its slot
+  CHECK(scanBytes < sizeof(ScanTable)); //No copy of the table
+  CHECK(deltaAllocations <= 1);
+  report("allocations: / %llu, probe %llu, /scan-status %llu (%llu bytes), /scan-status?since %llu, /start-scan %llu, /wifi-status %llu",
+    (unsigned long long)pageAllocations, (unsigned long long)probeAllocations, (unsigned long long)scanAllocations, (unsigned long long)scanBytes,
+    (unsigned long long)deltaAllocations, (unsigned long long)startScanAllocations, (unsigned long long)statusAllocations);
+}
+
+TEST(timeToPortal)
+{
+  addAccessPoint("home", 1, 6, -60, "homepass1");
+  fake::setMillis(1000); //BootTimeline reads 0 as not reached
+
+  EasyWifi fresh; //Nothing stored, the portal is all there is
+  Clock::time_point start = Clock::now();
+  fresh.setup();
+  long long freshNanos = elapsedNanos(start);
+  CHECK(AsyncWebServer::running() != nullptr);
+  CHECK_EQ(fresh.get_Metrics().boot.portalUp, fresh.get_Metrics().boot.setup); //Up before any radio wait
+  fresh.logoutCaptivePortal();
+
+  EasyWifi stored; //Portal first, stored networks are scanned for and tried behind it
+  stored.addCredential("office", "officepass");
+  stored.addCredential("home", "homepass1");
+  stored.set_PortalFirst(true);
+  start = Clock::now();
+  stored.setup();
+  long long storedNanos = elapsedNanos(start);
+  CHECK(AsyncWebServer::running() != nullptr);
+  CHECK_EQ(stored.get_Metrics().boot.portalUp, stored.get_Metrics().boot.setup);
+
+  CHECK(runUntil(stored, [&stored]{ return stored.get_WifiState() == WIFI_STATUS::CONNECTED; }, 30000));
+  const BootTimeline &boot = stored.get_Metrics().boot;
+  report("setup() to portal: %lld ns empty, %lld ns portal first", freshNanos, storedNanos);
+  report("portal first boot: portal up at +%u ms, first scan at +%u ms, connected at +%u ms (simulated)",
+    (unsigned)(boot.portalUp - boot.setup), (unsigned)(boot.firstScan - boot.setup), (unsigned)(boot.connected - boot.setup));
+}
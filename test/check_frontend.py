@@ -0,0 +1,29 @@
+import filecmp
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+# Fails if src/frontend.h is not what gen_frontend_header.py makes of data/easyWifi,
+# i.e. a frontend file was edited and the header was not regenerated.
+# Also fails if the LittleFS example ships different frontend files.
+repo_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+with tempfile.TemporaryDirectory() as work_dir:
+    # The generator reads and writes relative to the working directory, the tree itself is left untouched
+    shutil.copytree(os.path.join(repo_dir, "data", "easyWifi"), os.path.join(work_dir, "data", "easyWifi"))
+    shutil.copy(os.path.join(repo_dir, "gen_frontend_header.py"), work_dir)
+    subprocess.run([sys.executable, "gen_frontend_header.py"], cwd=work_dir, check=True, stdout=subprocess.DEVNULL)
+
+    if not filecmp.cmp(os.path.join(work_dir, "src", "frontend.h"), os.path.join(repo_dir, "src", "frontend.h"), shallow=False):
+        sys.exit("src/frontend.h is out of date, run gen_frontend_header.py from the repo root")
+
+frontend_dir = os.path.join(repo_dir, "data", "easyWifi")
+example_dir = os.path.join(repo_dir, "examples", "usingLittleFS", "data", "easyWifi")
+names = sorted(os.listdir(frontend_dir))
+_, mismatch, errors = filecmp.cmpfiles(frontend_dir, example_dir, names, shallow=False)
+if mismatch or errors:
+    sys.exit("examples/usingLittleFS/data/easyWifi differs from data/easyWifi: " + ", ".join(mismatch + errors))
+
+print("src/frontend.h and the LittleFS example match data/easyWifi")
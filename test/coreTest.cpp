@@ -0,0 +1,365 @@
+//Connection flow, reconnect policy and NVS writes of a whole EasyWifi against the fakes
+
+#include "simulation.h"
+#include <chrono>
+#include <vector>
+
+using namespace EASYWIFI;
+using namespace testing;
+
+//Record written straight to flash, like a previous firmware left it
+static void storeCredentials(const CredentialStore &store)
+{
+  uint8_t record[CREDENTIAL_RECORD_MAX_SIZE];
+  size_t size = store.pack(record);
+
+  Preferences nvs;
+  nvs.begin("wifiDataNVS", false);
+  nvs.putBytes("wifiRecord", record, size);
+  nvs.end();
+}
+
+static bool isSettled(EasyWifi &wifi)
+{
+  return wifi.get_WifiState() == WIFI_STATUS::CONNECTED || wifi.get_WifiState() == WIFI_STATUS::ERROR;
+}
+
+TEST(updateNeverBlocks)
+{
+  addAccessPoint("home", 1, 6, -55, "homepass1");
+  addAccessPoint("office", 2, 11, -65, "officepass");
+
+  EasyWifi wifi;
+  wifi.addCredential("office", "officepass");
+  wifi.addCredential("home", "homepass1");
+  wifi.setup();
+
+  //Scan, match and connection all happen in here, one short pass at a time
+  long long worst = 0;
+  for(int i = 0; i < 3000; i++)
+  {
+    fake::advance(10);
+    auto start = std::chrono::steady_clock::now();
+    wifi.update();
+    long long elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    if(elapsed > worst)
+      worst = elapsed;
+  }
+
+  CHECK(wifi.get_WifiState() == WIFI_STATUS::CONNECTED);
+  CHECK_STR(wifi.get_ssidStored(), "home");
+  CHECK_EQ(fake::delayCalls(), 0); //Nothing waits, setup() included
+  CHECK(worst < 2000);
+  report("slowest update(): %lld us", worst);
+}
+
+TEST(wrongPasswordTriesNextNetwork)
+{
+  addAccessPoint("strong", 1, 1, -40, "changedpass");
+  addAccessPoint("weak", 2, 6, -75, "weakpass1");
+
+  EasyWifi wifi;
+  wifi.addCredential("strong", "oldpass12");
+  wifi.addCredential("weak", "weakpass1");
+  int results = 0;
+  wifi.onConnectionResult([&results](WIFI_STATUS){ results++; });
+  wifi.setup();
+
+  CHECK(runUntil(wifi, [&wifi]{ return isSettled(wifi); }, 30000));
+  CHECK(wifi.get_WifiState() == WIFI_STATUS::CONNECTED);
+  CHECK_STR(wifi.get_ssidStored(), "weak");
+  CHECK_EQ(results, 1); //The fallback is part of the same attempt
+  CHECK_EQ(wifi.get_Metrics().failedConnects, 1);
+
+  //The rejection ends the first attempt right away, and its stale status doesn't end the second one
+  const std::vector<fake::BeginCall> &begins = fake::beginCalls();
+  if(CHECK_EQ(begins.size(), 2))
+  {
+    CHECK_STR(begins[0].ssid.c_str(), "strong");
+    CHECK_STR(begins[1].ssid.c_str(), "weak");
+    CHECK(begins[1].time - begins[0].time <= fake::connectTime + 10);
+  }
+}
+
+TEST(fastConnectFallsBackToFullScan)
+{
+  addAccessPoint("home", 1, 6, -50, "homepass1");
+
+  EasyWifi first;
+  first.addCredential("home", "homepass1");
+  first.setup();
+  CHECK(runUntil(first, [&first]{ return isSettled(first); }, 20000));
+  CHECK_EQ(first.get_credential(0).channel, 6);
+  WiFi.disconnect(); //Reboot
+
+  findAccessPoint(1)->channel = 11; //AP moved meanwhile
+  size_t previousBegins = fake::beginCalls().size();
+
+  EasyWifi second;
+  second.setup();
+  CHECK(runUntil(second, [&second]{ return isSettled(second); }, 20000));
+  CHECK(second.get_WifiState() == WIFI_STATUS::CONNECTED);
+  CHECK(!second.get_isFastConnect());
+  CHECK_EQ(second.get_credential(0).channel, 11); //Next boot joins the new channel directly
+
+  const std::vector<fake::BeginCall> &begins = fake::beginCalls();
+  if(CHECK_EQ(begins.size() - previousBegins, 2))
+  {
+    const fake::BeginCall &fast = begins[previousBegins];
+    const fake::BeginCall &fallback = begins[previousBegins + 1];
+    CHECK(fast.hasBssid);
+    CHECK_EQ(fast.channel, 6);
+    CHECK(!fallback.hasBssid);
+    CHECK_EQ(fallback.channel, 0);
+    CHECK(fallback.time - fast.time < FAST_CONNECT_TIMEOUT); //Ended by the driver event, not the timeout
+  }
+}
+
+TEST(unchangedReconnectWritesNothing)
+{
+  addAccessPoint("home", 1, 6, -50, "homepass1");
+
+  EasyWifi first;
+  first.addCredential("home", "homepass1");
+  first.setup();
+  CHECK(runUntil(first, [&first]{ return isSettled(first); }, 20000));
+  CHECK(fake::nvsWrites() > 0);
+  WiFi.disconnect();
+
+  fake::clearNvsWrites();
+  size_t previousScans = fake::scanCalls().size();
+
+  EasyWifi second;
+  second.setup();
+  CHECK(runUntil(second, [&second]{ return isSettled(second); }, 20000));
+  CHECK(second.get_WifiState() == WIFI_STATUS::CONNECTED);
+  CHECK(second.get_isFastConnect());
+  CHECK_EQ(fake::scanCalls().size(), previousScans);
+  CHECK_EQ(fake::nvsWrites(), 0); //Same network, AP and channel, flash already holds it
+  CHECK_EQ(second.get_Metrics().nvsWritesSkipped, 1);
+}
+
+TEST(legacyNetworkMigratesOnce)
+{
+  Preferences legacy;
+  legacy.begin("wifiDataNVS", false);
+  legacy.putString("ssid", "home");
+  legacy.putString("password", "homepass1");
+  legacy.putBool("isProtected", true);
+  legacy.end();
+  addAccessPoint("home", 1, 6, -50, "homepass1");
+
+  EasyWifi wifi;
+  wifi.setup();
+  CHECK_EQ(wifi.get_credentialCount(), 1);
+  CHECK_STR(wifi.get_credential(0).ssid, "home");
+  CHECK(wifi.get_credential(0).isProtected);
+
+  Preferences nvs;
+  nvs.begin("wifiDataNVS", true);
+  CHECK(nvs.isKey("wifiRecord"));
+  CHECK(!nvs.isKey("ssid"));
+  CHECK(!nvs.isKey("password"));
+  CHECK(!nvs.isKey("isProtected"));
+  nvs.end();
+
+  CHECK(runUntil(wifi, [&wifi]{ return isSettled(wifi); }, 20000));
+  CHECK(wifi.get_WifiState() == WIFI_STATUS::CONNECTED);
+}
+
+//Start times of every connection attempt while no stored network is in range
+static std::vector<unsigned long> retryTimes(uint32_t seed)
+{
+  fake::resetClock();
+  fake::resetWiFi();
+  fake::resetNvs();
+
+  EasyWifi wifi;
+  wifi.addCredential("home", "homepass1");
+  wifi.set_ReconnectSeed(seed);
+  wifi.set_ReconnectBackoff(2000, 16000);
+  wifi.set_ReconnectPolicy(CONNECT_FAILURE::NOT_FOUND, 0); //Never opens the portal
+  wifi.setup();
+  runFor(wifi, 120000);
+
+  std::vector<unsigned long> times;
+  for(const fake::BeginCall &begin : fake::beginCalls())
+    times.push_back(begin.time);
+  fake::resetWiFi(); //Drops the event handler of wifi
+  return times;
+}
+
+TEST(backoffTimelineIsDeterministic)
+{
+  std::vector<unsigned long> times = retryTimes(42);
+  CHECK(times == retryTimes(42));
+  CHECK(times != retryTimes(7));
+  CHECK(times.size() >= 7);
+
+  //Each round fails once the driver reports it, then waits between half and all of its backoff
+  for(size_t i = 0; i + 1 < times.size(); i++)
+  {
+    unsigned long backoff = i < 3 ? 2000ul << i : 16000ul;
+    unsigned long wait = times[i + 1] - times[i] - fake::connectTime;
+    if(!CHECK(wait >= backoff / 2 && wait <= backoff + 10))
+      report("round %u waited %lu ms, backoff %lu ms", (unsigned)i + 1, wait, backoff);
+  }
+}
+
+TEST(portalOpensAfterAuthFailures)
+{
+  addAccessPoint("home", 1, 6, -50, "newpass12");
+
+  EasyWifi wifi;
+  wifi.addCredential("home", "oldpass12");
+  wifi.set_ReconnectSeed(1);
+  wifi.setup();
+
+  CHECK(runUntil(wifi, []{ return AsyncWebServer::running() != nullptr; }, 60000));
+  CHECK_EQ(fake::beginCalls().size(), RECONNECT_AUTH_PORTAL_AFTER);
+  CHECK(fake::wifiMode() == WIFI_AP_STA);
+}
+
+TEST(portalOpensAfterNetworkIsGone)
+{
+  EasyWifi wifi;
+  wifi.addCredential("home", "homepass1");
+  wifi.set_ReconnectSeed(1);
+  wifi.setup();
+
+  CHECK(runUntil(wifi, []{ return AsyncWebServer::running() != nullptr; }, 300000));
+  CHECK_EQ(fake::beginCalls().size(), RECONNECT_NOT_FOUND_PORTAL_AFTER);
+}
+
+TEST(storedSsidsScanProbesKnownChannels)
+{
+  CredentialStore store;
+  const uint8_t bssidA[6] = {0x24, 0x0a, 0xc4, 0x00, 0x00, 1};
+  const uint8_t bssidB[6] = {0x24, 0x0a, 0xc4, 0x00, 0x00, 2};
+  store.setLastAccessPoint(store.add("alpha", "alphapass", true), bssidA, 1);
+  store.setLastAccessPoint(store.add("bravo", "bravopass", true), bssidB, 6);
+  store.add("charlie", "charliepass", true); //Never connected, channel unknown
+  storeCredentials(store);
+
+  addAccessPoint("alpha", 1, 1, -60, "alphapass");
+  addAccessPoint("bravo", 2, 6, -50, "bravopass");
+  addAccessPoint("charlie", 3, 11, -70, "charliepass");
+
+  EasyWifi wifi;
+  wifi.setup();
+  CHECK(runUntil(wifi, [&wifi]{ return isSettled(wifi); }, 30000));
+  CHECK(wifi.get_WifiState() == WIFI_STATUS::CONNECTED);
+  CHECK_STR(wifi.get_ssidStored(), "bravo");
+
+  //One short directed probe per known channel, they found a network so the full pass is skipped
+  const std::vector<fake::ScanCall> &scans = fake::scanCalls();
+  if(CHECK_EQ(scans.size(), 2))
+  {
+    CHECK_STR(scans[0].ssid.c_str(), "alpha");
+    CHECK_EQ(scans[0].channel, 1);
+    CHECK_EQ(scans[0].dwell, SCAN_TARGETED_DWELL);
+    CHECK(!scans[0].isPassive);
+    CHECK_STR(scans[1].ssid.c_str(), "bravo");
+    CHECK_EQ(scans[1].channel, 6);
+  }
+}
+
+TEST(storedSsidsScanFallsBackToFullPass)
+{
+  CredentialStore store;
+  const uint8_t bssidA[6] = {0x24, 0x0a, 0xc4, 0x00, 0x00, 1};
+  store.setLastAccessPoint(store.add("alpha", "alphapass", true), bssidA, 1);
+  store.add("charlie", "charliepass", true); //Never connected, channel unknown
+  storeCredentials(store);
+
+  addAccessPoint("alpha", 1, 9, -60, "alphapass"); //Moved since the last connection
+  addAccessPoint("charlie", 3, 11, -70, "charliepass");
+
+  EasyWifi wifi;
+  wifi.setup();
+  CHECK(runUntil(wifi, [&wifi]{ return isSettled(wifi); }, 30000));
+  CHECK(wifi.get_WifiState() == WIFI_STATUS::CONNECTED);
+
+  //The probe missed, one full pass finds both
+  const std::vector<fake::ScanCall> &scans = fake::scanCalls();
+  if(CHECK_EQ(scans.size(), 2))
+  {
+    CHECK_STR(scans[0].ssid.c_str(), "alpha");
+    CHECK_EQ(scans[0].channel, 1);
+    CHECK_STR(scans[1].ssid.c_str(), "");
+    CHECK_EQ(scans[1].channel, 0);
+    CHECK_EQ(scans[1].dwell, SCAN_DEFAULT_DWELL);
+  }
+}
+
+TEST(portalFirstConnectsBehindThePortal)
+{
+  addAccessPoint("home", 1, 6, -55, "homepass1");
+
+  EasyWifi wifi;
+  wifi.addCredential("home", "homepass1");
+  wifi.set_PortalFirst(true);
+  wifi.setup();
+  CHECK(AsyncWebServer::running() != nullptr); //Up before any radio wait
+  CHECK(fake::wifiMode() == WIFI_AP_STA);
+
+  CHECK(runUntil(wifi, [&wifi]{ return wifi.get_WifiState() == WIFI_STATUS::CONNECTED; }, 20000));
+  runFor(wifi, PORTAL_LOGOUT_DELAY + 100);
+  CHECK(AsyncWebServer::running() == nullptr);
+  CHECK(fake::wifiMode() == WIFI_STA);
+}
+
+TEST(portalFirstKeepsRetryingBehindThePortal)
+{
+  EasyWifi wifi;
+  wifi.addCredential("home", "homepass1");
+  wifi.set_PortalFirst(true);
+  wifi.set_ReconnectSeed(1);
+  wifi.set_ReconnectBackoff(2000, 16000);
+  wifi.setup();
+
+  //Router still booting, rounds keep failing and backing off while the portal stays up
+  runFor(wifi, 30000);
+  CHECK(AsyncWebServer::running() != nullptr);
+  CHECK(fake::wifiMode() == WIFI_AP_STA);
+  CHECK(fake::beginCalls().size() >= 3);
+  CHECK(wifi.get_reconnectFailures() >= 2);
+
+  addAccessPoint("home", 1, 6, -55, "homepass1");
+  CHECK(runUntil(wifi, [&wifi]{ return wifi.get_WifiState() == WIFI_STATUS::CONNECTED; }, 20000));
+  CHECK_EQ(wifi.get_reconnectFailures(), 0);
+}
+
+TEST(portalConnectReplacesBackgroundAttempt)
+{
+  addAccessPoint("home", 1, 6, -55, "homepass1");
+  addAccessPoint("cafe", 2, 1, -60, "cafepass1");
+  fake::connectTime = 5000; //Long enough to submit while the stored network is still being tried
+
+  EasyWifi wifi;
+  wifi.addCredential("home", "wrongpass");
+  wifi.set_PortalFirst(true);
+  wifi.setup();
+  runFor(wifi, 100);
+  CHECK(wifi.get_WifiState() == WIFI_STATUS::CONNECTING);
+  size_t begins = fake::beginCalls().size();
+
+  AsyncWebServerRequest submit(HTTP_POST, "/start-wifi");
+  submit.withParam("ssid", "cafe", true).withParam("password", "cafepass1", true).withParam("isProtected", "1", true);
+  AsyncWebServerResponse *response = handle(submit);
+  if(!CHECK(response != nullptr))
+    return;
+  CHECK_EQ(response->code(), 200);
+
+  runFor(wifi, 10);
+  CHECK_EQ(fake::beginCalls().size(), begins + 1);
+  CHECK(fake::beginCalls().back().ssid == "cafe");
+
+  //A second phone can't replace the user's attempt
+  AsyncWebServerRequest second(HTTP_POST, "/start-wifi");
+  second.withParam("ssid", "home", true).withParam("password", "homepass1", true).withParam("isProtected", "1", true);
+  CHECK_EQ(handle(second)->code(), 409);
+
+  CHECK(runUntil(wifi, [&wifi]{ return wifi.get_WifiState() == WIFI_STATUS::CONNECTED; }, 20000));
+  CHECK_STR(wifi.get_ssidStored(), "cafe");
+}
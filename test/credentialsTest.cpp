@@ -0,0 +1,147 @@
+//Credential store, built with CREDENTIALS_MAX=32 like a big deployment
+
+#include "testing.h"
+#include <easyWifiCredentials.h>
+#include <chrono>
+
+using namespace EASYWIFI;
+using namespace testing;
+
+static_assert(CREDENTIALS_MAX == 32, "credentialsTest is built with CREDENTIALS_MAX=32");
+
+TEST(recordRoundTrips)
+{
+  CredentialStore store;
+  const uint8_t bssid[6] = {1, 2, 3, 4, 5, 6};
+  store.add("home", "homepass1", true, 2);
+  store.add("cafe", "", false);
+  store.setLastAccessPoint(0, bssid, 11);
+  store.markSuccess(0);
+
+  uint8_t record[CREDENTIAL_RECORD_MAX_SIZE];
+  size_t size = store.pack(record);
+  CHECK_EQ(size, sizeof(CredentialRecordHeader) + 2 * sizeof(WifiCredential));
+
+  CredentialStore copy;
+  CHECK(copy.unpack(record, size));
+  CHECK_EQ(copy.count(), 2);
+  CHECK_EQ(copy.find("cafe"), 1);
+  CHECK_STR(copy.get(0).passwd, "homepass1");
+  CHECK_EQ(copy.get(0).priority, 2);
+  CHECK_EQ(copy.get(0).channel, 11);
+  CHECK_EQ(copy.get(0).lastSuccess, 1);
+  CHECK(memcmp(copy.get(0).bssid, bssid, 6) == 0);
+}
+
+TEST(damagedRecordIsRejected)
+{
+  CredentialStore store;
+  store.add("home", "homepass1", true);
+  uint8_t record[CREDENTIAL_RECORD_MAX_SIZE];
+  size_t size = store.pack(record);
+
+  CredentialStore target;
+  target.add("kept", "keptpass1", true);
+
+  record[size - 1] ^= 0x01; //Flipped bit in an entry
+  CHECK(!target.unpack(record, size));
+  record[size - 1] ^= 0x01;
+
+  CHECK(!target.unpack(record, size - 1)); //Truncated
+  record[4] = CREDENTIAL_RECORD_VERSION + 1; //Newer firmware wrote it
+  CHECK(!target.unpack(record, size));
+
+  CHECK_EQ(target.count(), 1); //Left untouched
+  CHECK_EQ(target.find("kept"), 0);
+}
+
+TEST(rankingWeighsPriorityAndRecentSuccess)
+{
+  CredentialStore store;
+  store.add("strong", "pass12345", true);
+  store.add("favourite", "pass12345", true, 1);
+  store.add("recent", "pass12345", true);
+  store.add("away", "pass12345", true, 5);
+  store.markSuccess(store.find("recent"));
+
+  store.beginMatch();
+  store.offer("strong", -50);
+  store.offer("favourite", -58); //1 priority level makes up 10 dB
+  store.offer("recent", -60);
+  store.offer("recent", -54); //Second AP of the same network, strongest counts
+  store.offer("stranger", -30);
+
+  uint8_t order[CREDENTIALS_MAX];
+  CHECK_EQ(store.rank(order), 3);
+  CHECK_EQ(order[0], store.find("favourite")); //-48
+  CHECK_EQ(order[1], store.find("recent"));    //-49
+  CHECK_EQ(order[2], store.find("strong"));    //-50
+
+  CHECK_EQ(store.rank(order, true), 4);
+  CHECK_EQ(order[3], store.find("away")); //Unseen go last whatever their priority
+}
+
+TEST(fullStoreReplacesLeastUseful)
+{
+  CredentialStore store;
+  char ssid[SSID_MAX_LENGTH + 1];
+  for(uint8_t i = 0; i < CREDENTIALS_MAX; i++)
+  {
+    snprintf(ssid, sizeof(ssid), "net-%02u", i);
+    store.add(ssid, "pass12345", true, 1);
+  }
+  store.add("net-05", "pass12345", true, 0); //Same network, priority lowered
+  for(uint8_t i = 0; i < CREDENTIALS_MAX; i++)
+    if(i != 5)
+      store.markSuccess(i);
+
+  CHECK(store.add("newcomer", "pass12345", true, 1) >= 0);
+  CHECK_EQ(store.count(), CREDENTIALS_MAX);
+  CHECK_EQ(store.find("net-05"), -1);
+  CHECK(store.find("newcomer") >= 0);
+
+  CHECK(store.remove("net-00"));
+  CHECK_EQ(store.find("net-00"), -1);
+  CHECK(store.find("net-31") >= 0); //Index rebuilt after the shift
+}
+
+TEST(matchOf32StoredAgainst60Scanned)
+{
+  CredentialStore store;
+  char ssid[SSID_MAX_LENGTH + 1];
+  for(uint8_t i = 0; i < CREDENTIALS_MAX; i++)
+  {
+    snprintf(ssid, sizeof(ssid), "stored-network-%02u", i);
+    store.add(ssid, "pass12345", true);
+  }
+
+  //Half of the stored networks are around, among strangers
+  char scanned[60][SSID_MAX_LENGTH + 1];
+  int8_t rssi[60];
+  for(uint8_t i = 0; i < 60; i++)
+  {
+    if(i % 4 == 0)
+      snprintf(scanned[i], sizeof(scanned[i]), "stored-network-%02u", i / 2);
+    else
+      snprintf(scanned[i], sizeof(scanned[i]), "neighbour-%02u", i);
+    rssi[i] = -30 - i;
+  }
+
+  const int rounds = 20000;
+  uint8_t order[CREDENTIALS_MAX];
+  uint8_t length = 0;
+  auto start = std::chrono::steady_clock::now();
+  for(int round = 0; round < rounds; round++)
+  {
+    store.beginMatch();
+    for(uint8_t i = 0; i < 60; i++)
+      store.offer(scanned[i], rssi[i]);
+    length = store.rank(order);
+  }
+  double elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+  CHECK_EQ(length, 15);
+  CHECK_EQ(order[0], store.find("stored-network-00"));
+  CHECK_EQ(order[14], store.find("stored-network-28"));
+  report("match of %d stored against 60 scanned: %.2f us", CREDENTIALS_MAX, elapsed / rounds);
+}
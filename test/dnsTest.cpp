@@ -0,0 +1,141 @@
+//Captive DNS answered from the AsyncUDP task, built with EASYWIFI_ASYNC_DNS
+
+#include "simulation.h"
+#include <AsyncUDP.h>
+#include <chrono>
+#include <vector>
+
+using namespace EASYWIFI;
+using namespace testing;
+
+#define TYPE_A    1
+#define TYPE_AAAA 28
+
+static std::vector<uint8_t> query(const char *name, uint16_t type, uint8_t flags = 0x01)
+{
+  std::vector<uint8_t> packet = { 0x12, 0x34, flags, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+  while(*name)
+  {
+    const char *dot = strchr(name, '.');
+    size_t length = dot ? (size_t)(dot - name) : strlen(name);
+    packet.push_back(length);
+    packet.insert(packet.end(), name, name + length);
+    name += length + (dot ? 1 : 0);
+  }
+  const uint8_t tail[] = { 0x00, (uint8_t)(type >> 8), (uint8_t)type, 0x00, 0x01 };
+  packet.insert(packet.end(), tail, tail + sizeof(tail));
+  return packet;
+}
+
+static std::vector<uint8_t> ask(AsyncUDP *socket, const std::vector<uint8_t> &packet)
+{
+  AsyncUDPPacket request(packet.data(), packet.size());
+  socket->receive(request);
+  return request.reply();
+}
+
+TEST(everyNameResolvesToThePortal)
+{
+  CaptiveDnsServer dns;
+  CHECK(dns.start(53, "*", IPAddress(192, 168, 4, 1)));
+  AsyncUDP *socket = AsyncUDP::listening(53);
+  if(!CHECK(socket != nullptr))
+    return;
+
+  std::vector<uint8_t> question = query("connectivitycheck.gstatic.com", TYPE_A);
+  std::vector<uint8_t> reply = ask(socket, question);
+  if(!CHECK_EQ(reply.size(), question.size() + DNS_ANSWER_LENGTH))
+    return;
+
+  CHECK(std::equal(question.begin() + DNS_HEADER_LENGTH, question.end(), reply.begin() + DNS_HEADER_LENGTH)); //Question copied back
+  CHECK_EQ(reply[0], 0x12);
+  CHECK_EQ(reply[1], 0x34);
+  CHECK_EQ(reply[2], 0x85); //Response, authoritative, recursion desired kept
+  CHECK_EQ(reply[3], 0x80);
+  CHECK_EQ(reply[7], 1); //One answer
+  CHECK_EQ(reply[reply.size() - 7], DNS_DEFAULT_TTL);
+  const uint8_t ip[] = { 192, 168, 4, 1 };
+  CHECK(memcmp(reply.data() + reply.size() - 4, ip, 4) == 0);
+  CHECK_EQ(dns.get_answers(), 1);
+}
+
+TEST(otherTypesGetAnEmptyAnswer)
+{
+  CaptiveDnsServer dns;
+  dns.start(53, "*", IPAddress(192, 168, 4, 1));
+  std::vector<uint8_t> question = query("example.com", TYPE_AAAA);
+  std::vector<uint8_t> reply = ask(AsyncUDP::listening(53), question);
+
+  CHECK_EQ(reply.size(), question.size());
+  CHECK_EQ(reply[3], 0x80); //NOERROR, so the client falls back to A
+  CHECK_EQ(reply[7], 0);
+}
+
+TEST(additionalRecordsAreDropped)
+{
+  CaptiveDnsServer dns;
+  dns.start(53, "*", IPAddress(192, 168, 4, 1));
+  std::vector<uint8_t> question = query("example.com", TYPE_A);
+  size_t questionEnd = question.size();
+  question[11] = 1; //EDNS OPT record follows
+  const uint8_t opt[] = { 0x00, 0x00, 0x29, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+  question.insert(question.end(), opt, opt + sizeof(opt));
+
+  std::vector<uint8_t> reply = ask(AsyncUDP::listening(53), question);
+  CHECK_EQ(reply.size(), questionEnd + DNS_ANSWER_LENGTH);
+  CHECK_EQ(reply[11], 0);
+}
+
+TEST(malformedQueriesAreIgnored)
+{
+  CaptiveDnsServer dns;
+  dns.start(53, "*", IPAddress(192, 168, 4, 1));
+  AsyncUDP *socket = AsyncUDP::listening(53);
+
+  CHECK(ask(socket, query("example.com", TYPE_A, 0x81)).empty()); //A response, not a query
+
+  std::vector<uint8_t> compressed = query("example.com", TYPE_A);
+  compressed[DNS_HEADER_LENGTH] = 0xC0;
+  CHECK(ask(socket, compressed).empty());
+
+  std::vector<uint8_t> truncated = query("example.com", TYPE_A);
+  truncated.resize(truncated.size() - 3);
+  CHECK(ask(socket, truncated).empty());
+
+  std::vector<uint8_t> header(DNS_HEADER_LENGTH, 0);
+  CHECK(ask(socket, header).empty());
+
+  CHECK_EQ(dns.get_queries(), 4);
+  CHECK_EQ(dns.get_answers(), 0);
+}
+
+TEST(portalOwnsPort53)
+{
+  EasyWifi wifi;
+  wifi.setup();
+  CHECK(AsyncUDP::listening(53) != nullptr);
+  wifi.logoutCaptivePortal();
+  CHECK(AsyncUDP::listening(53) == nullptr);
+}
+
+TEST(answerRate)
+{
+  CaptiveDnsServer dns;
+  dns.start(53, "*", IPAddress(192, 168, 4, 1));
+  AsyncUDP *socket = AsyncUDP::listening(53);
+  std::vector<uint8_t> question = query("www.msftconnecttest.com", TYPE_A);
+
+  const int queries = 200000;
+  uint64_t allocations = fake::heap().allocations;
+  auto start = std::chrono::steady_clock::now();
+  for(int i = 0; i < queries; i++)
+  {
+    AsyncUDPPacket request(question.data(), question.size());
+    socket->receive(request);
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  CHECK_EQ(dns.get_answers(), queries);
+  CHECK_EQ(fake::heap().allocations - allocations, 0);
+  report("%.0f queries/s on the host, %.2f us each", queries / seconds, seconds * 1e6 / queries);
+}
@@ -0,0 +1,120 @@
+//Arduino.cpp - host fake
+
+#include "Arduino.h"
+#include <atomic>
+#include <new>
+
+#define FAKE_HEAP_SIZE 320000 //Free heap of an ESP32 with WiFi started, roughly
+
+EspClass ESP;
+
+//Atomic, an EASYWIFI_TASK task moves the clock while the test thread reads it
+static std::atomic<unsigned long> fakeMillis{0};
+static std::atomic<uint32_t> fakeDelayCalls{0};
+static uint32_t fakeRandom = 1;
+
+unsigned long millis() { return fakeMillis; }
+unsigned long micros() { return fakeMillis * 1000; }
+
+void delay(uint32_t ms)
+{
+  fakeDelayCalls++;
+  fakeMillis += ms;
+}
+
+uint32_t esp_random()
+{
+  //xorshift32, same sequence on every run
+  fakeRandom ^= fakeRandom << 13;
+  fakeRandom ^= fakeRandom >> 17;
+  fakeRandom ^= fakeRandom << 5;
+  return fakeRandom;
+}
+
+void String::toCharArray(char *out, unsigned int size) const
+{
+  if(size == 0)
+    return;
+  size_t length = _text.size() < size - 1 ? _text.size() : size - 1;
+  memcpy(out, _text.c_str(), length);
+  out[length] = '\0';
+}
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  size_t written = 0;
+  while(size--)
+    written += write(*buffer++);
+  return written;
+}
+
+namespace fake{
+
+void setMillis(unsigned long ms) { fakeMillis = ms; }
+void advance(unsigned long ms) { fakeMillis += ms; }
+uint32_t delayCalls() { return fakeDelayCalls; }
+
+void resetClock()
+{
+  fakeMillis = 0;
+  fakeDelayCalls = 0;
+  fakeRandom = 1;
+}
+
+};
+
+//Heap accounting, every allocation carries its size in front of it
+static std::atomic<uint64_t> heapAllocations{0};
+static std::atomic<uint64_t> heapAllocatedBytes{0};
+static std::atomic<int64_t> heapLiveBytes{0};
+static thread_local int heapPauses = 0;
+
+#define HEAP_HEADER 16 //Keeps the returned pointer aligned like malloc
+
+static void* countedAlloc(size_t size)
+{
+  uint8_t *block = static_cast<uint8_t*>(malloc(size + HEAP_HEADER));
+  if(block == nullptr)
+    throw std::bad_alloc();
+
+  memcpy(block, &size, sizeof(size));
+  heapLiveBytes += size;
+  if(heapPauses == 0)
+  {
+    heapAllocations++;
+    heapAllocatedBytes += size;
+  }
+  return block + HEAP_HEADER;
+}
+
+static void countedFree(void *pointer)
+{
+  if(pointer == nullptr)
+    return;
+
+  uint8_t *block = static_cast<uint8_t*>(pointer) - HEAP_HEADER;
+  size_t size;
+  memcpy(&size, block, sizeof(size));
+  heapLiveBytes -= size;
+  free(block);
+}
+
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+void operator delete(void *pointer) noexcept { countedFree(pointer); }
+void operator delete[](void *pointer) noexcept { countedFree(pointer); }
+void operator delete(void *pointer, size_t) noexcept { countedFree(pointer); }
+void operator delete[](void *pointer, size_t) noexcept { countedFree(pointer); }
+
+uint32_t EspClass::getFreeHeap()
+{
+  return FAKE_HEAP_SIZE - (uint32_t)heapLiveBytes.load();
+}
+
+fake::HeapStats fake::heap()
+{
+  return { heapAllocations.load(), heapAllocatedBytes.load(), heapLiveBytes.load() };
+}
+
+fake::HeapPause::HeapPause() { heapPauses++; }
+fake::HeapPause::~HeapPause() { heapPauses--; }
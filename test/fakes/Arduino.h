@@ -0,0 +1,100 @@
+#pragma once
+
+/*
+*   Host fake of the Arduino core, only what easyWifi uses.
+*   Time is simulated: millis() and micros() only move when a test calls fake::advance(),
+*   so timeouts, backoffs and cache TTLs replay the same way on every run.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <functional>
+#include <string>
+#include "FreeRTOS.h" //The real core brings in FreeRTOS too
+
+#define PROGMEM
+#define IRAM_ATTR
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms); //Advances the simulated clock, counted so tests can assert nothing waits
+uint32_t esp_random();
+
+class String
+{
+  public:
+    String(const char *text = "") : _text(text ? text : "") {};
+    String(const std::string &text) : _text(text) {};
+    explicit String(int value) : _text(std::to_string(value)) {};
+
+    const char* c_str() const { return _text.c_str(); };
+    unsigned int length() const { return _text.length(); };
+    void toCharArray(char *out, unsigned int size) const;
+
+    bool operator==(const char *text) const { return _text == text; };
+    bool operator==(const String &other) const { return _text == other._text; };
+    bool operator!=(const char *text) const { return _text != text; };
+
+  private:
+    std::string _text;
+};
+
+class Print
+{
+  public:
+    virtual ~Print() = default;
+    virtual size_t write(uint8_t byte) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size);
+
+    size_t print(const char *text) { return write(reinterpret_cast<const uint8_t*>(text), strlen(text)); };
+    size_t println(const char *text) { return print(text) + println(); };
+    size_t println() { return print("\r\n"); };
+};
+
+class IPAddress
+{
+  public:
+    IPAddress() : _bytes{0, 0, 0, 0} {};
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _bytes{a, b, c, d} {};
+    uint8_t operator[](int index) const { return _bytes[index]; };
+
+  private:
+    uint8_t _bytes[4];
+};
+
+class EspClass
+{
+  public:
+    uint32_t getFreeHeap(); //Simulated heap size minus what the fake heap counts as live
+};
+extern EspClass ESP;
+
+namespace fake{
+
+void setMillis(unsigned long ms);
+void advance(unsigned long ms);
+uint32_t delayCalls();
+void resetClock(); //Back to boot, delay() counter cleared
+
+//Every operator new/delete of the test binary is counted here
+struct HeapStats
+{
+  uint64_t allocations; //Calls to operator new outside fake code
+  uint64_t allocatedBytes; //Requested by those calls, freed or not
+  int64_t liveBytes;    //Allocated and not freed yet, fake code included
+};
+HeapStats heap();
+
+//Allocations made by fakes aren't counted while one of these is alive, so tests see only the library's
+class HeapPause
+{
+  public:
+    HeapPause();
+    ~HeapPause();
+};
+
+};
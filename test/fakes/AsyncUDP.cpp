@@ -0,0 +1,63 @@
+//AsyncUDP.cpp - host fake
+
+#include "AsyncUDP.h"
+
+using fake::HeapPause;
+
+static std::vector<AsyncUDP*> sockets; //Bound ones
+
+size_t AsyncUDPPacket::write(const uint8_t *data, size_t length)
+{
+  HeapPause pause;
+  _reply.assign(data, data + length);
+  return length;
+}
+
+AsyncUDP::~AsyncUDP()
+{
+  close();
+}
+
+bool AsyncUDP::listen(uint16_t port)
+{
+  HeapPause pause;
+  if(listening(port))
+    return false; //Port in use
+  close();
+  _port = port;
+  sockets.push_back(this);
+  return true;
+}
+
+void AsyncUDP::close()
+{
+  for(size_t i = 0; i < sockets.size(); i++)
+  {
+    if(sockets[i] == this)
+    {
+      sockets.erase(sockets.begin() + i);
+      break;
+    }
+  }
+  _port = 0;
+}
+
+AsyncUDP* AsyncUDP::listening(uint16_t port)
+{
+  for(AsyncUDP *socket : sockets)
+    if(socket->_port == port)
+      return socket;
+  return nullptr;
+}
+
+void fake::resetUdp()
+{
+  HeapPause pause;
+  sockets.clear(); //Sockets left bound are leaked with their server, never closed
+}
+
+void AsyncUDP::receive(AsyncUDPPacket &packet)
+{
+  if(_onPacket)
+    _onPacket(packet);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+/*
+*   Host fake of AsyncUDP, only what easyWifi uses.
+*   A test looks up the socket listening on a port and feeds it packets with receive(),
+*   the handler runs right away and whatever it writes back is kept on the packet.
+*/
+
+#include <Arduino.h>
+#include <vector>
+
+class AsyncUDPPacket
+{
+  public:
+    AsyncUDPPacket(const uint8_t *data, size_t length) : _data(data), _length(length) {};
+
+    uint8_t* data() { return const_cast<uint8_t*>(_data); };
+    size_t length() { return _length; };
+    size_t write(const uint8_t *data, size_t length);
+    IPAddress remoteIP() { return IPAddress(192, 168, 4, 2); };
+    uint16_t remotePort() { return 5353; };
+
+    //Test side, bytes sent back to the client
+    const std::vector<uint8_t>& reply() const { return _reply; };
+
+  private:
+    const uint8_t *_data;
+    size_t _length;
+    std::vector<uint8_t> _reply;
+};
+
+typedef std::function<void(AsyncUDPPacket &packet)> AuPacketHandlerFunction;
+
+class AsyncUDP
+{
+  public:
+    ~AsyncUDP();
+    bool listen(uint16_t port);
+    void close();
+    void onPacket(AuPacketHandlerFunction callback) { _onPacket = callback; };
+
+    //Test side
+    static AsyncUDP* listening(uint16_t port); //nullptr if no socket is bound to it
+    void receive(AsyncUDPPacket &packet);
+
+  private:
+    uint16_t _port = 0;
+    AuPacketHandlerFunction _onPacket;
+};
+
+namespace fake{
+
+void resetUdp(); //Unbinds every port, a test may end with its DNS still listening
+
+};
@@ -0,0 +1,22 @@
+//DNSServer.cpp - host fake
+
+#include "DNSServer.h"
+
+bool DNSServer::start(uint16_t port, const String &domainName, const IPAddress &resolvedIP)
+{
+  (void)port;
+  (void)domainName;
+  (void)resolvedIP;
+  _isRunning = true;
+  return true;
+}
+
+void DNSServer::stop()
+{
+  _isRunning = false;
+}
+
+void DNSServer::processNextRequest()
+{
+  _polls++;
+}
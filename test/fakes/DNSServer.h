@@ -0,0 +1,20 @@
+#pragma once
+
+//Host fake of the Arduino DNSServer, only records whether it is answering
+#include <Arduino.h>
+
+class DNSServer
+{
+  public:
+    bool start(uint16_t port, const String &domainName, const IPAddress &resolvedIP);
+    void stop();
+    void processNextRequest();
+
+    //Test side
+    bool isRunning() const { return _isRunning; };
+    uint32_t polls() const { return _polls; };
+
+  private:
+    bool _isRunning = false;
+    uint32_t _polls = 0;
+};
@@ -0,0 +1,318 @@
+//ESPAsyncWebServer.cpp - host fake
+
+#include "ESPAsyncWebServer.h"
+
+using fake::HeapPause;
+
+size_t AsyncWebServerResponse::chunkSize = 64; //Small, so fillers are called many times
+
+static AsyncWebServer *runningServer = nullptr;
+
+void AsyncWebServerResponse::addHeader(const char *name, const char *value, bool replace)
+{
+  HeapPause pause;
+  if(replace)
+  {
+    for(auto &header : _headers)
+    {
+      if(header.first == name)
+      {
+        header.second = value;
+        return;
+      }
+    }
+  }
+  _headers.emplace_back(name, value);
+}
+
+const char* AsyncWebServerResponse::header(const char *name) const
+{
+  for(const auto &header : _headers)
+    if(strcasecmp(header.first.c_str(), name) == 0)
+      return header.second.c_str();
+  return nullptr;
+}
+
+const std::string& AsyncWebServerResponse::body()
+{
+  HeapPause pause;
+  if(!_filler)
+    return _body;
+
+  std::vector<uint8_t> chunk(chunkSize);
+  size_t length;
+  while((length = _filler(chunk.data(), chunk.size(), _body.size())) != 0)
+    _body.append(reinterpret_cast<const char*>(chunk.data()), length);
+  _filler = nullptr; //Releases whatever the filler kept alive, like the end of a real response
+  return _body;
+}
+
+size_t AsyncResponseStream::write(uint8_t byte)
+{
+  HeapPause pause;
+  _body.push_back(byte);
+  return 1;
+}
+
+size_t AsyncResponseStream::write(const uint8_t *buffer, size_t size)
+{
+  HeapPause pause;
+  _body.append(reinterpret_cast<const char*>(buffer), size);
+  return size;
+}
+
+AsyncWebServerRequest::AsyncWebServerRequest(WebRequestMethod method, const char *url, const char *host) :
+  _method(method), _url(url), _host(host)
+{
+}
+
+AsyncWebServerRequest::~AsyncWebServerRequest()
+{
+  delete _response;
+}
+
+AsyncWebServerRequest& AsyncWebServerRequest::withHeader(const char *name, const char *value)
+{
+  _headers.emplace_back(name, String(value));
+  return *this;
+}
+
+AsyncWebServerRequest& AsyncWebServerRequest::withParam(const char *name, const char *value, bool isPost)
+{
+  _params.emplace_back(name, value, isPost);
+  return *this;
+}
+
+bool AsyncWebServerRequest::hasHeader(const char *name) const
+{
+  for(const auto &header : _headers)
+    if(strcasecmp(header.first.c_str(), name) == 0)
+      return true;
+  return false;
+}
+
+const String& AsyncWebServerRequest::header(const char *name) const
+{
+  static const String empty;
+  for(const auto &header : _headers)
+    if(strcasecmp(header.first.c_str(), name) == 0)
+      return header.second;
+  return empty;
+}
+
+bool AsyncWebServerRequest::hasParam(const char *name, bool isPost) const
+{
+  return getParam(name, isPost) != nullptr;
+}
+
+const AsyncWebParameter* AsyncWebServerRequest::getParam(const char *name, bool isPost) const
+{
+  for(const AsyncWebParameter &param : _params)
+    if(param.name() == name && param.isPost() == isPost)
+      return &param;
+  return nullptr;
+}
+
+//Arguments are query and form parameters alike
+bool AsyncWebServerRequest::hasArg(const char *name) const
+{
+  for(const AsyncWebParameter &param : _params)
+    if(param.name() == name)
+      return true;
+  return false;
+}
+
+const String& AsyncWebServerRequest::arg(const char *name) const
+{
+  static const String empty;
+  for(const AsyncWebParameter &param : _params)
+    if(param.name() == name)
+      return param.value();
+  return empty;
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(int code, const char *contentType, const char *content)
+{
+  HeapPause pause;
+  AsyncWebServerResponse *response = new AsyncWebServerResponse(code, contentType);
+  if(content)
+    response->_body = content;
+  return response;
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(const char *contentType, size_t length, AwsResponseFiller filler)
+{
+  HeapPause pause;
+  (void)length; //Fillers return 0 once everything is sent
+  AsyncWebServerResponse *response = new AsyncWebServerResponse(200, contentType);
+  response->_filler = filler;
+  return response;
+}
+
+//Like AsyncFileResponse, a .gz file sent under its plain path is marked as gzip
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(File content, const String &path, const char *contentType)
+{
+  HeapPause pause;
+  AsyncWebServerResponse *response = new AsyncWebServerResponse(200, contentType);
+  response->_body.resize(content.size());
+  response->_body.resize(content.read(reinterpret_cast<uint8_t*>(&response->_body[0]), response->_body.size()));
+
+  const char *name = content.name();
+  size_t nameLength = strlen(name);
+  if(nameLength > 3 && strcmp(name + nameLength - 3, ".gz") == 0 && path.length() > 3 && strcmp(path.c_str() + path.length() - 3, ".gz") != 0)
+    response->addHeader("Content-Encoding", "gzip");
+  content.close();
+  return response;
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(FS &fs, const String &path, const char *contentType)
+{
+  std::string gzipPath = std::string(path.c_str()) + ".gz";
+  bool isGzip = !fs.exists(path.c_str()) && fs.exists(gzipPath.c_str());
+  return beginResponse(fs.open(isGzip ? gzipPath.c_str() : path.c_str(), "r"), path, contentType);
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse_P(int code, const char *contentType, const uint8_t *content, size_t length)
+{
+  HeapPause pause;
+  AsyncWebServerResponse *response = new AsyncWebServerResponse(code, contentType);
+  response->_body.assign(reinterpret_cast<const char*>(content), length);
+  return response;
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginChunkedResponse(const char *contentType, AwsResponseFiller filler)
+{
+  HeapPause pause;
+  AsyncWebServerResponse *response = new AsyncWebServerResponse(200, contentType);
+  response->_filler = filler;
+  return response;
+}
+
+AsyncResponseStream* AsyncWebServerRequest::beginResponseStream(const char *contentType, size_t bufferSize)
+{
+  HeapPause pause;
+  (void)bufferSize;
+  return new AsyncResponseStream(contentType);
+}
+
+void AsyncWebServerRequest::send(AsyncWebServerResponse *response)
+{
+  delete _response; //A second send replaces the first, the test sees the last one
+  _response = response;
+}
+
+void AsyncWebServerRequest::send(int code, const char *contentType, const char *content)
+{
+  send(beginResponse(code, contentType, content));
+}
+
+void AsyncWebServerRequest::redirect(const char *url, int code)
+{
+  AsyncWebServerResponse *response = beginResponse(code);
+  response->addHeader("Location", url);
+  send(response);
+}
+
+bool AsyncCallbackWebHandler::canHandle(const AsyncWebServerRequest &request) const
+{
+  return (_method & request.method()) && _uri == request.url().c_str();
+}
+
+void AsyncEventSourceClient::send(const char *message, const char *event, uint32_t id, uint32_t reconnect)
+{
+  HeapPause pause;
+  (void)reconnect;
+  _source._sent.push_back({ event ? event : "", message, id });
+}
+
+void AsyncEventSource::send(const char *message, const char *event, uint32_t id, uint32_t reconnect)
+{
+  HeapPause pause;
+  (void)reconnect;
+  if(!_clients.empty()) //Sent once to every client, recorded once
+    _sent.push_back({ event ? event : "", message, id });
+}
+
+void AsyncEventSource::connectClient()
+{
+  HeapPause pause;
+  _clients.emplace_back(new AsyncEventSourceClient(*this));
+  if(_onConnect)
+    _onConnect(_clients.back().get());
+}
+
+AsyncWebServer::AsyncWebServer(uint16_t port)
+{
+  (void)port;
+}
+
+AsyncWebServer::~AsyncWebServer()
+{
+  HeapPause pause;
+  end();
+  _routes.clear();
+  _handlers.clear();
+}
+
+void AsyncWebServer::begin()
+{
+  runningServer = this;
+}
+
+void AsyncWebServer::end()
+{
+  if(runningServer == this)
+    runningServer = nullptr;
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char *uri, WebRequestMethod method, ArRequestHandlerFunction onRequest)
+{
+  HeapPause pause;
+  _routes.emplace_back(new AsyncCallbackWebHandler(uri, method, onRequest));
+  return *_routes.back();
+}
+
+AsyncWebHandler& AsyncWebServer::addHandler(AsyncWebHandler *handler)
+{
+  HeapPause pause;
+  _handlers.emplace_back(handler);
+  return *handler;
+}
+
+AsyncWebServer* AsyncWebServer::running()
+{
+  return runningServer;
+}
+
+void AsyncWebServer::handle(AsyncWebServerRequest &request)
+{
+  for(auto &route : _routes)
+  {
+    if(route->canHandle(request))
+    {
+      route->handle(request);
+      return;
+    }
+  }
+
+  if(_onNotFound)
+    _onNotFound(&request);
+  else
+    request.send(404);
+}
+
+void fake::resetWebServer()
+{
+  runningServer = nullptr;
+}
+
+AsyncEventSource* AsyncWebServer::eventSource(const char *url)
+{
+  for(auto &handler : _handlers)
+  {
+    AsyncEventSource *source = dynamic_cast<AsyncEventSource*>(handler.get());
+    if(source && source->url() == url)
+      return source;
+  }
+  return nullptr;
+}
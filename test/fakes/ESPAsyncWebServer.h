@@ -0,0 +1,207 @@
+#pragma once
+
+/*
+*   Host fake of ESPAsyncWebServer, only what easyWifi uses.
+*   Tests build an AsyncWebServerRequest, hand it to the running server with handle() and read the
+*   response it got. Chunked responses are drained only when the test reads the body, so a test can
+*   change the library state while a response is still "on the wire".
+*/
+
+#include <Arduino.h>
+#include <FS.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+typedef enum {
+  HTTP_GET = 0b00000001,
+  HTTP_POST = 0b00000010,
+  HTTP_ANY = 0b01111111,
+} WebRequestMethod;
+
+typedef std::function<size_t(uint8_t*, size_t, size_t)> AwsResponseFiller;
+
+class AsyncWebServerRequest;
+typedef std::function<void(AsyncWebServerRequest*)> ArRequestHandlerFunction;
+
+class AsyncWebServerResponse
+{
+  public:
+    AsyncWebServerResponse(int code, const char *contentType) : _code(code), _contentType(contentType ? contentType : "") {};
+    virtual ~AsyncWebServerResponse() = default;
+
+    void setCode(int code) { _code = code; };
+    void addHeader(const char *name, const char *value, bool replace = true);
+
+    //Test side
+    int code() const { return _code; };
+    const std::string& contentType() const { return _contentType; };
+    const char* header(const char *name) const; //nullptr if not sent
+    const std::string& body(); //Drains a chunked filler on first call
+
+    static size_t chunkSize; //maxLen handed to chunked fillers
+
+  private:
+    friend class AsyncWebServerRequest;
+
+    int _code;
+    std::string _contentType;
+    std::vector<std::pair<std::string, std::string>> _headers;
+
+  protected:
+    std::string _body;
+    AwsResponseFiller _filler;
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print
+{
+  public:
+    explicit AsyncResponseStream(const char *contentType) : AsyncWebServerResponse(200, contentType) {};
+    size_t write(uint8_t byte) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+};
+
+class AsyncWebParameter
+{
+  public:
+    AsyncWebParameter(const std::string &name, const std::string &value, bool isPost) : _name(name), _value(value.c_str()), _isPost(isPost) {};
+    const String& value() const { return _value; };
+    const std::string& name() const { return _name; };
+    bool isPost() const { return _isPost; };
+
+  private:
+    std::string _name;
+    String _value;
+    bool _isPost;
+};
+
+class AsyncWebServerRequest
+{
+  public:
+    AsyncWebServerRequest(WebRequestMethod method, const char *url, const char *host = "192.168.4.1");
+    ~AsyncWebServerRequest();
+
+    //Test side, build the request
+    AsyncWebServerRequest& withHeader(const char *name, const char *value);
+    AsyncWebServerRequest& withParam(const char *name, const char *value, bool isPost = false);
+    AsyncWebServerResponse* response() const { return _response; }; //nullptr if nothing was sent
+    WebRequestMethod method() const { return _method; };
+
+    //Library side
+    const String& url() const { return _url; };
+    const String& host() const { return _host; };
+    bool hasHeader(const char *name) const;
+    const String& header(const char *name) const;
+    bool hasParam(const char *name, bool isPost = false) const;
+    const AsyncWebParameter* getParam(const char *name, bool isPost = false) const;
+    bool hasArg(const char *name) const;
+    const String& arg(const char *name) const;
+
+    AsyncWebServerResponse* beginResponse(int code, const char *contentType = nullptr, const char *content = nullptr);
+    AsyncWebServerResponse* beginResponse(const char *contentType, size_t length, AwsResponseFiller filler);
+    AsyncWebServerResponse* beginResponse(File content, const String &path, const char *contentType); //Read when built
+    AsyncWebServerResponse* beginResponse(FS &fs, const String &path, const char *contentType); //path.gz only if path is missing
+    AsyncWebServerResponse* beginResponse_P(int code, const char *contentType, const uint8_t *content, size_t length);
+    AsyncWebServerResponse* beginChunkedResponse(const char *contentType, AwsResponseFiller filler);
+    AsyncResponseStream* beginResponseStream(const char *contentType, size_t bufferSize = 1460);
+
+    void send(AsyncWebServerResponse *response);
+    void send(int code, const char *contentType = nullptr, const char *content = nullptr);
+    void redirect(const char *url, int code = 302);
+
+  private:
+    WebRequestMethod _method;
+    String _url;
+    String _host;
+    std::vector<std::pair<std::string, String>> _headers;
+    std::vector<AsyncWebParameter> _params;
+    AsyncWebServerResponse *_response = nullptr;
+};
+
+class AsyncWebHandler
+{
+  public:
+    virtual ~AsyncWebHandler() = default;
+};
+
+class AsyncCallbackWebHandler : public AsyncWebHandler
+{
+  public:
+    AsyncCallbackWebHandler(const char *uri, WebRequestMethod method, ArRequestHandlerFunction onRequest) : _uri(uri), _method(method), _onRequest(onRequest) {};
+    bool canHandle(const AsyncWebServerRequest &request) const;
+    void handle(AsyncWebServerRequest &request) { _onRequest(&request); };
+
+  private:
+    std::string _uri;
+    WebRequestMethod _method;
+    ArRequestHandlerFunction _onRequest;
+};
+
+class AsyncEventSourceClient
+{
+  public:
+    explicit AsyncEventSourceClient(class AsyncEventSource &source) : _source(source) {};
+    void send(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
+
+  private:
+    class AsyncEventSource &_source;
+};
+
+typedef std::function<void(AsyncEventSourceClient*)> ArEventHandlerFunction;
+
+class AsyncEventSource : public AsyncWebHandler
+{
+  public:
+    explicit AsyncEventSource(const char *url) : _url(url) {};
+    void onConnect(ArEventHandlerFunction callback) { _onConnect = callback; };
+    void send(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
+    size_t count() const { return _clients.size(); };
+
+    //Test side
+    struct Event
+    {
+      std::string event;
+      std::string data;
+      uint32_t id;
+    };
+    void connectClient(); //Runs onConnect, its sends are recorded with the others
+    const std::vector<Event>& sent() const { return _sent; };
+    const std::string& url() const { return _url; };
+
+  private:
+    friend class AsyncEventSourceClient;
+
+    std::string _url;
+    ArEventHandlerFunction _onConnect;
+    std::vector<std::unique_ptr<AsyncEventSourceClient>> _clients;
+    std::vector<Event> _sent;
+};
+
+class AsyncWebServer
+{
+  public:
+    explicit AsyncWebServer(uint16_t port);
+    ~AsyncWebServer();
+
+    void begin();
+    void end();
+    AsyncCallbackWebHandler& on(const char *uri, WebRequestMethod method, ArRequestHandlerFunction onRequest);
+    void onNotFound(ArRequestHandlerFunction fn) { _onNotFound = fn; };
+    AsyncWebHandler& addHandler(AsyncWebHandler *handler);
+
+    //Test side
+    static AsyncWebServer* running(); //Server that called begin() last and is not ended, nullptr otherwise
+    void handle(AsyncWebServerRequest &request); //Routes the request like the async_tcp task would
+    AsyncEventSource* eventSource(const char *url);
+
+  private:
+    std::vector<std::unique_ptr<AsyncCallbackWebHandler>> _routes;
+    std::vector<std::unique_ptr<AsyncWebHandler>> _handlers; //Deleted with the server, like the real one
+    ArRequestHandlerFunction _onNotFound;
+};
+
+namespace fake{
+
+void resetWebServer(); //Forgets the running server, a test may end with its portal still open
+
+};
@@ -0,0 +1,92 @@
+//FS.cpp - host fake
+
+#include "FS.h"
+#include "LittleFS.h"
+#include <sys/stat.h>
+
+fs::LittleFSFS LittleFS;
+
+namespace fake{
+
+static char root[128] = "";
+static bool isMounted = false;
+static uint32_t opens = 0;
+
+void setFileSystemRoot(const char *directory)
+{
+  isMounted = directory != nullptr;
+  snprintf(root, sizeof(root), "%s", directory ? directory : "");
+}
+
+uint32_t fileOpens() { return opens; }
+
+void resetFileSystem()
+{
+  setFileSystemRoot(nullptr);
+  opens = 0;
+}
+
+static bool hostPath(const char *path, char *out, size_t outLen)
+{
+  return isMounted && path[0] == '/' && snprintf(out, outLen, "%s%s", root, path) < (int)outLen;
+}
+
+};
+
+using namespace fake;
+
+size_t fs::File::read(uint8_t *buffer, size_t size)
+{
+  char file[256];
+  if(!_isOpen || _isDirectory || !hostPath(_path, file, sizeof(file)))
+    return 0;
+
+  FILE *host = fopen(file, "rb");
+  if(host == nullptr)
+    return 0;
+  fseek(host, _position, SEEK_SET);
+  size_t length = fread(buffer, 1, size, host);
+  fclose(host);
+  _position += length;
+  return length;
+}
+
+const char* fs::File::name() const
+{
+  const char *slash = strrchr(_path, '/');
+  return slash ? slash + 1 : _path;
+}
+
+bool fs::FS::exists(const char *path)
+{
+  char file[256];
+  struct stat info;
+  return hostPath(path, file, sizeof(file)) && stat(file, &info) == 0;
+}
+
+fs::File fs::FS::open(const char *path, const char *mode)
+{
+  (void)mode;
+  File opened;
+  char file[256];
+  struct stat info;
+  if(!hostPath(path, file, sizeof(file)) || stat(file, &info) != 0 || strlen(path) >= sizeof(opened._path))
+    return opened;
+
+  opens++;
+  opened._isOpen = true;
+  opened._isDirectory = S_ISDIR(info.st_mode);
+  opened._size = opened._isDirectory ? 0 : info.st_size;
+  opened._lastWrite = info.st_mtime;
+  strcpy(opened._path, path);
+  return opened;
+}
+
+bool fs::LittleFSFS::begin(bool formatOnFail, const char *basePath, uint8_t maxOpenFiles, const char *partitionLabel)
+{
+  (void)formatOnFail;
+  (void)basePath;
+  (void)maxOpenFiles;
+  (void)partitionLabel;
+  return isMounted;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+/*
+*   Host fake of the Arduino FS API, backed by a directory of the host.
+*   fake::setFileSystemRoot("/tmp/x") maps "/easyWifi/index.htm" to "/tmp/x/easyWifi/index.htm".
+*   A File only keeps its path and position, every read() goes to the host file.
+*/
+
+#include <Arduino.h>
+
+namespace fs{
+
+class File
+{
+  public:
+    File() = default;
+    explicit operator bool() const { return _isOpen; };
+
+    bool isDirectory() const { return _isDirectory; };
+    size_t size() const { return _size; };
+    size_t read(uint8_t *buffer, size_t size);
+    time_t getLastWrite() const { return _lastWrite; };
+    const char* name() const; //Last path component, like the real one
+    const char* path() const { return _path; };
+    void close() { _isOpen = false; };
+
+  private:
+    friend class FS;
+
+    bool _isOpen = false;
+    bool _isDirectory = false;
+    char _path[128] = "";
+    size_t _size = 0;
+    size_t _position = 0;
+    time_t _lastWrite = 0;
+};
+
+class FS
+{
+  public:
+    virtual ~FS() = default;
+    bool exists(const char *path);
+    File open(const char *path, const char *mode = "r"); //Read only, an invalid File if missing
+};
+
+};
+
+using fs::FS;
+using fs::File;
+
+namespace fake{
+
+void setFileSystemRoot(const char *directory); //nullptr unmounts, LittleFS.begin() then fails
+uint32_t fileOpens(); //Every open(), so tests can tell a cache hit from a flash read
+void resetFileSystem();
+
+};
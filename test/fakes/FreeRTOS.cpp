@@ -0,0 +1,77 @@
+//FreeRTOS.cpp - host fake
+
+#include "FreeRTOS.h"
+#include "Arduino.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+struct FakeTask
+{
+  TaskFunction_t function;
+  void *parameter;
+  fake::TaskInfo info;
+};
+
+static thread_local FakeTask *currentTask = nullptr;
+static std::atomic<uint32_t> taskCount{0};
+static std::atomic<uint32_t> parkedTasks{0};
+static std::atomic<bool> isStopping{false};
+static fake::TaskInfo lastInfo = {};
+//Never destroyed, parked tasks wait on them until the process exits
+static std::mutex &parkMutex = *new std::mutex;
+static std::condition_variable &parkSignal = *new std::condition_variable;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, uint32_t stackDepth, void *parameter,
+  UBaseType_t priority, TaskHandle_t *handle, BaseType_t core)
+{
+  fake::HeapPause pause;
+  FakeTask *task = new FakeTask{ function, parameter, { name, stackDepth, priority, core } };
+  lastInfo = task->info;
+  if(handle)
+    *handle = task; //Before the task runs, it may check its own handle right away
+  taskCount++;
+
+  std::thread([task]{
+    currentTask = task;
+    task->function(task->parameter);
+  }).detach();
+  return pdPASS;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() { return currentTask; }
+
+void vTaskDelay(TickType_t ticks)
+{
+  if(isStopping)
+  {
+    std::unique_lock<std::mutex> lock(parkMutex);
+    parkedTasks++;
+    parkSignal.notify_all();
+    parkSignal.wait(lock, []{ return false; });
+  }
+  fake::advance(ticks);
+  std::this_thread::sleep_for(std::chrono::microseconds(50)); //Real time too, so the test thread gets in between passes
+}
+
+namespace fake{
+
+uint32_t taskCount() { return ::taskCount; }
+TaskInfo lastTask() { return lastInfo; }
+
+void stopTasks()
+{
+  uint32_t running = ::taskCount.exchange(0);
+  if(running == 0)
+    return;
+
+  std::unique_lock<std::mutex> lock(parkMutex);
+  isStopping = true;
+  parkSignal.wait(lock, [running]{ return parkedTasks == running; });
+  parkedTasks = 0;
+  isStopping = false;
+}
+
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+/*
+*   Host fake of the FreeRTOS task API the Arduino core brings in, only what EASYWIFI_TASK uses.
+*   Each task is a thread. vTaskDelay() moves the simulated clock by its ticks, so a task
+*   running update() lets time pass on its own while the test thread calls into the library.
+*/
+
+#include <stdint.h>
+
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void *parameter);
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdPASS 1
+#define pdFAIL 0
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms)) //1 kHz tick, like the Arduino core
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, uint32_t stackDepth, void *parameter,
+  UBaseType_t priority, TaskHandle_t *handle, BaseType_t core);
+TaskHandle_t xTaskGetCurrentTaskHandle(); //nullptr on the test thread
+void vTaskDelay(TickType_t ticks);
+
+namespace fake{
+
+struct TaskInfo
+{
+  const char *name;
+  uint32_t stackDepth;
+  UBaseType_t priority;
+  BaseType_t core;
+};
+uint32_t taskCount(); //Created since the last stopTasks()
+TaskInfo lastTask();
+void stopTasks(); //Returns once every task is parked in vTaskDelay() for good, the objects they use can then be destroyed
+
+};
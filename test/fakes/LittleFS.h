@@ -0,0 +1,17 @@
+#pragma once
+
+//Host fake of the ESP32 LittleFS, a FS over the directory given to fake::setFileSystemRoot()
+#include "FS.h"
+
+namespace fs{
+
+class LittleFSFS : public FS
+{
+  public:
+    bool begin(bool formatOnFail = false, const char *basePath = "/littlefs", uint8_t maxOpenFiles = 10, const char *partitionLabel = "spiffs");
+    void end() {};
+};
+
+};
+
+extern fs::LittleFSFS LittleFS;
@@ -0,0 +1,117 @@
+//Preferences.cpp - host fake
+
+#include "Preferences.h"
+#include <map>
+#include <vector>
+
+typedef std::map<std::string, std::vector<uint8_t>> NvsNamespace;
+
+static std::map<std::string, NvsNamespace> flash;
+static uint32_t writes = 0;
+
+namespace fake{
+
+void resetNvs()
+{
+  HeapPause pause;
+  flash.clear();
+  writes = 0;
+}
+
+uint32_t nvsWrites() { return writes; }
+void clearNvsWrites() { writes = 0; }
+
+};
+
+bool Preferences::begin(const char *name, bool readOnly, const char *partitionLabel)
+{
+  fake::HeapPause pause;
+  (void)partitionLabel;
+  _namespace = name;
+  _isOpen = true;
+  _isReadOnly = readOnly;
+  return true;
+}
+
+void Preferences::end()
+{
+  _isOpen = false;
+}
+
+bool Preferences::clear()
+{
+  fake::HeapPause pause;
+  if(!isWritable())
+    return false;
+  flash[_namespace].clear();
+  writes++;
+  return true;
+}
+
+bool Preferences::remove(const char *key)
+{
+  fake::HeapPause pause;
+  if(!isWritable() || flash[_namespace].erase(key) == 0)
+    return false;
+  writes++;
+  return true;
+}
+
+bool Preferences::isKey(const char *key)
+{
+  fake::HeapPause pause;
+  return _isOpen && flash[_namespace].count(key) != 0;
+}
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t length)
+{
+  fake::HeapPause pause;
+  if(!isWritable())
+    return 0;
+  const uint8_t *bytes = static_cast<const uint8_t*>(value);
+  flash[_namespace][key].assign(bytes, bytes + length);
+  writes++;
+  return length;
+}
+
+size_t Preferences::getBytes(const char *key, void *buffer, size_t maxLength)
+{
+  fake::HeapPause pause;
+  if(!isKey(key))
+    return 0;
+  const std::vector<uint8_t> &value = flash[_namespace][key];
+  if(value.size() > maxLength) //NVS refuses to truncate
+    return 0;
+  memcpy(buffer, value.data(), value.size());
+  return value.size();
+}
+
+size_t Preferences::getBytesLength(const char *key)
+{
+  fake::HeapPause pause;
+  return isKey(key) ? flash[_namespace][key].size() : 0;
+}
+
+size_t Preferences::putString(const char *key, const char *value)
+{
+  return putBytes(key, value, strlen(value) + 1) ? strlen(value) : 0;
+}
+
+//Length with the terminator, like the ESP32 core
+size_t Preferences::getString(const char *key, char *value, size_t maxLength)
+{
+  return getBytes(key, value, maxLength);
+}
+
+size_t Preferences::putBool(const char *key, bool value)
+{
+  uint8_t byte = value;
+  return putBytes(key, &byte, 1);
+}
+
+bool Preferences::getBool(const char *key, bool defaultValue)
+{
+  uint8_t byte = defaultValue;
+  getBytes(key, &byte, 1);
+  return byte != 0;
+}
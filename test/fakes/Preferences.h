@@ -0,0 +1,42 @@
+#pragma once
+
+/*
+*   Host fake of the ESP32 Preferences (NVS), kept in memory for the whole test binary.
+*   Every write that would reach flash is counted, so tests can assert when nothing is written.
+*/
+
+#include <Arduino.h>
+
+class Preferences
+{
+  public:
+    bool begin(const char *name, bool readOnly = false, const char *partitionLabel = nullptr);
+    void end();
+
+    bool clear();
+    bool remove(const char *key);
+    bool isKey(const char *key);
+
+    size_t putBytes(const char *key, const void *value, size_t length);
+    size_t getBytes(const char *key, void *buffer, size_t maxLength);
+    size_t getBytesLength(const char *key);
+    size_t putString(const char *key, const char *value);
+    size_t getString(const char *key, char *value, size_t maxLength);
+    size_t putBool(const char *key, bool value);
+    bool getBool(const char *key, bool defaultValue = false);
+
+  private:
+    bool isWritable() const { return _isOpen && !_isReadOnly; };
+
+    std::string _namespace;
+    bool _isOpen = false;
+    bool _isReadOnly = true;
+};
+
+namespace fake{
+
+void resetNvs(); //Erases every namespace and the counters
+uint32_t nvsWrites(); //put, remove and clear calls that changed flash
+void clearNvsWrites();
+
+};
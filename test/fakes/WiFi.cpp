@@ -0,0 +1,296 @@
+//WiFi.cpp - host fake
+
+#include "WiFi.h"
+
+WiFiClass WiFi;
+
+namespace fake{
+
+unsigned long connectTime = 300;
+bool isNextScanFailing = false;
+bool isNextScanStuck = false;
+
+static std::vector<AccessPoint> air;
+static std::vector<ScanCall> scans;
+static std::vector<BeginCall> begins;
+static std::vector<WiFiEventFuncCb> disconnectHandlers;
+
+static wl_status_t status = WL_IDLE_STATUS;
+static wifi_mode_t mode = WIFI_OFF;
+static int connectedAp = -1; //Index in air
+
+//Attempt started by begin(), resolved once its time comes
+static bool isAttemptPending = false;
+static unsigned long attemptEnd = 0;
+static std::string attemptSsid;
+static std::string attemptPassword;
+static int32_t attemptChannel = 0;
+static bool attemptHasBssid = false;
+static uint8_t attemptBssid[6];
+
+static bool isScanRunning = false;
+static bool isScanStuck = false;
+static unsigned long scanEnd = 0;
+static std::vector<wifi_ap_record_t> scanResults;
+static bool hasScanResults = false;
+
+void resetWiFi()
+{
+  HeapPause pause;
+  air.clear();
+  scans.clear();
+  begins.clear();
+  disconnectHandlers.clear();
+  status = WL_IDLE_STATUS;
+  mode = WIFI_OFF;
+  connectedAp = -1;
+  isAttemptPending = false;
+  isScanRunning = false;
+  isScanStuck = false;
+  scanResults.clear();
+  hasScanResults = false;
+  connectTime = 300;
+  isNextScanFailing = false;
+  isNextScanStuck = false;
+}
+
+void addAccessPoint(const AccessPoint &accessPoint)
+{
+  HeapPause pause;
+  air.push_back(accessPoint);
+}
+
+AccessPoint* findAccessPoint(const uint8_t *bssid)
+{
+  for(AccessPoint &accessPoint : air)
+    if(memcmp(accessPoint.bssid, bssid, 6) == 0)
+      return &accessPoint;
+  return nullptr;
+}
+
+const std::vector<ScanCall>& scanCalls() { return scans; }
+const std::vector<BeginCall>& beginCalls() { return begins; }
+wifi_mode_t wifiMode() { return mode; }
+
+static void raiseDisconnected(uint8_t reason)
+{
+  arduino_event_info_t info;
+  memset(&info, 0, sizeof(info));
+  info.wifi_sta_disconnected.reason = reason;
+  for(WiFiEventFuncCb &handler : disconnectHandlers)
+    handler(ARDUINO_EVENT_WIFI_STA_DISCONNECTED, info);
+}
+
+//Driver events happen on their own, here they are applied whenever the library looks at the driver
+static void poll()
+{
+  if(!isAttemptPending || (long)(millis() - attemptEnd) < 0)
+    return;
+  isAttemptPending = false;
+
+  int best = -1;
+  for(size_t i = 0; i < air.size(); i++)
+  {
+    const AccessPoint &accessPoint = air[i];
+    if(accessPoint.ssid != attemptSsid)
+      continue;
+    if(attemptChannel != 0 && accessPoint.channel != attemptChannel)
+      continue;
+    if(attemptHasBssid && memcmp(accessPoint.bssid, attemptBssid, 6) != 0)
+      continue;
+    if(best < 0 || accessPoint.rssi > air[best].rssi)
+      best = i;
+  }
+
+  if(best < 0)
+  {
+    status = WL_NO_SSID_AVAIL; //Set before the event, like the Arduino event handler does
+    raiseDisconnected(WIFI_REASON_NO_AP_FOUND);
+    return;
+  }
+
+  if(!air[best].password.empty() && air[best].password != attemptPassword)
+  {
+    status = WL_CONNECT_FAILED;
+    raiseDisconnected(WIFI_REASON_AUTH_FAIL);
+    return;
+  }
+
+  connectedAp = best;
+  status = WL_CONNECTED;
+}
+
+};
+
+using namespace fake;
+
+wl_status_t WiFiClass::begin(const char *ssid, const char *passphrase, int32_t channel, const uint8_t *bssid, bool connect)
+{
+  HeapPause pause;
+  (void)connect;
+  begins.push_back({ ssid, channel, bssid != nullptr, millis() });
+
+  if(connectedAp >= 0) //Joining another AP leaves the current one first
+  {
+    connectedAp = -1;
+    fake::status = WL_DISCONNECTED;
+  }
+
+  //status() is left as it is, the real driver only changes it on the next event
+  isAttemptPending = true;
+  attemptEnd = millis() + connectTime;
+  attemptSsid = ssid;
+  attemptPassword = passphrase ? passphrase : "";
+  attemptChannel = channel;
+  attemptHasBssid = bssid != nullptr;
+  if(bssid)
+    memcpy(attemptBssid, bssid, 6);
+  return fake::status;
+}
+
+wl_status_t WiFiClass::status()
+{
+  poll();
+  return fake::status;
+}
+
+bool WiFiClass::disconnect(bool wifiOff, bool eraseAp)
+{
+  (void)wifiOff;
+  (void)eraseAp;
+  isAttemptPending = false;
+  if(connectedAp >= 0)
+  {
+    connectedAp = -1;
+    fake::status = WL_DISCONNECTED;
+  }
+  raiseDisconnected(WIFI_REASON_ASSOC_LEAVE); //A failed status is kept, nothing resets it
+  return true;
+}
+
+bool WiFiClass::isConnected()
+{
+  poll();
+  return fake::status == WL_CONNECTED;
+}
+
+bool WiFiClass::setAutoReconnect(bool autoReconnect)
+{
+  (void)autoReconnect;
+  return true;
+}
+
+bool WiFiClass::mode(wifi_mode_t mode)
+{
+  fake::mode = mode;
+  return true;
+}
+
+wifi_event_id_t WiFiClass::onEvent(WiFiEventFuncCb callback, arduino_event_id_t event)
+{
+  HeapPause pause;
+  (void)event;
+  disconnectHandlers.push_back(callback);
+  return disconnectHandlers.size();
+}
+
+int16_t WiFiClass::scanNetworks(bool async, bool showHidden, bool passive, uint32_t maxMsPerChannel, uint8_t channel, const char *ssid, const uint8_t *bssid)
+{
+  HeapPause pause;
+  (void)async;
+  (void)showHidden;
+  (void)bssid;
+  scans.push_back({ ssid ? ssid : "", channel, passive, maxMsPerChannel, millis() });
+
+  if(isNextScanFailing)
+  {
+    isNextScanFailing = false;
+    return WIFI_SCAN_FAILED;
+  }
+
+  //Results are what is in the air when the scan starts
+  scanResults.clear();
+  for(const AccessPoint &accessPoint : air)
+  {
+    if((channel != 0 && accessPoint.channel != channel) || (ssid && accessPoint.ssid != ssid))
+      continue;
+
+    wifi_ap_record_t record;
+    memset(&record, 0, sizeof(record));
+    memcpy(record.bssid, accessPoint.bssid, 6);
+    strncpy(reinterpret_cast<char*>(record.ssid), accessPoint.ssid.c_str(), 32);
+    record.primary = accessPoint.channel;
+    record.rssi = accessPoint.rssi;
+    record.authmode = accessPoint.password.empty() ? WIFI_AUTH_OPEN : WIFI_AUTH_WPA2_PSK;
+    scanResults.push_back(record);
+  }
+
+  isScanRunning = true;
+  isScanStuck = isNextScanStuck;
+  isNextScanStuck = false;
+  hasScanResults = false;
+  scanEnd = millis() + maxMsPerChannel * (channel ? 1 : FAKE_SCAN_CHANNELS);
+  return WIFI_SCAN_RUNNING;
+}
+
+int16_t WiFiClass::scanComplete()
+{
+  if(isScanRunning && (isScanStuck || (long)(millis() - scanEnd) < 0))
+    return WIFI_SCAN_RUNNING;
+
+  if(isScanRunning)
+  {
+    isScanRunning = false;
+    hasScanResults = true;
+  }
+  return hasScanResults ? scanResults.size() : WIFI_SCAN_FAILED;
+}
+
+void WiFiClass::scanDelete()
+{
+  HeapPause pause;
+  isScanRunning = false;
+  hasScanResults = false;
+  scanResults.clear();
+}
+
+void* WiFiClass::getScanInfoByIndex(int index)
+{
+  if(!hasScanResults || index < 0 || index >= (int)scanResults.size())
+    return nullptr;
+  return &scanResults[index];
+}
+
+uint8_t* WiFiClass::BSSID()
+{
+  poll();
+  return connectedAp >= 0 ? air[connectedAp].bssid : nullptr;
+}
+
+int32_t WiFiClass::channel()
+{
+  poll();
+  return connectedAp >= 0 ? air[connectedAp].channel : 0;
+}
+
+int8_t WiFiClass::RSSI()
+{
+  poll();
+  return connectedAp >= 0 ? air[connectedAp].rssi : 0;
+}
+
+bool WiFiClass::softAP(const char *ssid, const char *passphrase, int channel, int hidden, int maxConnections)
+{
+  (void)ssid;
+  (void)passphrase;
+  (void)channel;
+  (void)hidden;
+  (void)maxConnections;
+  fake::mode = WIFI_AP_STA;
+  return true;
+}
+
+IPAddress WiFiClass::softAPIP()
+{
+  return IPAddress(192, 168, 4, 1);
+}
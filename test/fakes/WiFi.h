@@ -0,0 +1,132 @@
+#pragma once
+
+/*
+*   Host fake of the Arduino-ESP32 WiFi driver, only what easyWifi uses.
+*   Access points are put "in the air" with fake::addAccessPoint(). Scans and connection attempts
+*   finish after a simulated time, like the real driver: WiFi.status() keeps its old value until the
+*   attempt ends, then the STA_DISCONNECTED event of a failure is raised before status() returns.
+*/
+
+#include <Arduino.h>
+#include <string>
+#include <vector>
+
+typedef enum {
+  WL_NO_SHIELD = 255,
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL,
+  WL_SCAN_COMPLETED,
+  WL_CONNECTED,
+  WL_CONNECT_FAILED,
+  WL_CONNECTION_LOST,
+  WL_DISCONNECTED
+} wl_status_t;
+
+typedef enum { WIFI_AUTH_OPEN = 0, WIFI_AUTH_WEP, WIFI_AUTH_WPA_PSK, WIFI_AUTH_WPA2_PSK } wifi_auth_mode_t;
+typedef enum { WIFI_OFF = 0, WIFI_STA, WIFI_AP, WIFI_AP_STA } wifi_mode_t;
+
+typedef struct {
+  uint8_t bssid[6];
+  uint8_t ssid[33];
+  uint8_t primary;
+  int second;
+  int8_t rssi;
+  wifi_auth_mode_t authmode;
+} wifi_ap_record_t;
+
+#define WIFI_SCAN_RUNNING (-1)
+#define WIFI_SCAN_FAILED  (-2)
+
+typedef enum { ARDUINO_EVENT_WIFI_STA_DISCONNECTED = 7 } arduino_event_id_t;
+typedef enum {
+  WIFI_REASON_ASSOC_LEAVE = 8,
+  WIFI_REASON_BEACON_TIMEOUT = 200,
+  WIFI_REASON_NO_AP_FOUND = 201,
+  WIFI_REASON_AUTH_FAIL = 202
+} wifi_err_reason_t;
+
+typedef struct {
+  uint8_t ssid[32];
+  uint8_t ssid_len;
+  uint8_t bssid[6];
+  uint8_t reason;
+  int8_t rssi;
+} wifi_event_sta_disconnected_t;
+
+typedef union {
+  wifi_event_sta_disconnected_t wifi_sta_disconnected;
+} arduino_event_info_t;
+
+typedef uint16_t wifi_event_id_t;
+typedef std::function<void(arduino_event_id_t, arduino_event_info_t)> WiFiEventFuncCb;
+
+class WiFiClass
+{
+  public:
+    wl_status_t begin(const char *ssid, const char *passphrase = nullptr, int32_t channel = 0, const uint8_t *bssid = nullptr, bool connect = true);
+    wl_status_t status();
+    bool disconnect(bool wifiOff = false, bool eraseAp = false);
+    bool isConnected();
+    bool setAutoReconnect(bool autoReconnect);
+    bool mode(wifi_mode_t mode);
+    wifi_event_id_t onEvent(WiFiEventFuncCb callback, arduino_event_id_t event);
+
+    int16_t scanNetworks(bool async = false, bool showHidden = false, bool passive = false, uint32_t maxMsPerChannel = 300,
+                         uint8_t channel = 0, const char *ssid = nullptr, const uint8_t *bssid = nullptr);
+    int16_t scanComplete();
+    void scanDelete();
+    void* getScanInfoByIndex(int index);
+
+    uint8_t* BSSID();
+    int32_t channel();
+    int8_t RSSI();
+
+    bool softAP(const char *ssid, const char *passphrase = nullptr, int channel = 1, int hidden = 0, int maxConnections = 4);
+    IPAddress softAPIP();
+};
+
+extern WiFiClass WiFi;
+
+namespace fake{
+
+#define FAKE_SCAN_CHANNELS 13 //A scan without a channel visits all of them
+
+struct AccessPoint
+{
+  std::string ssid;
+  uint8_t bssid[6];
+  uint8_t channel;
+  int8_t rssi;
+  std::string password; //Empty for an open network
+};
+
+struct ScanCall
+{
+  std::string ssid; //Empty if not directed
+  uint8_t channel;  //0 for every channel
+  bool isPassive;
+  uint32_t dwell;
+  unsigned long time;
+};
+
+struct BeginCall
+{
+  std::string ssid;
+  int32_t channel;
+  bool hasBssid;
+  unsigned long time;
+};
+
+void resetWiFi(); //Empty air, idle driver, logs cleared
+void addAccessPoint(const AccessPoint &accessPoint);
+AccessPoint* findAccessPoint(const uint8_t *bssid); //To move or weaken an AP during a test
+
+extern unsigned long connectTime; //ms from begin() to the attempt result
+extern bool isNextScanFailing;    //scanNetworks() returns WIFI_SCAN_FAILED once
+extern bool isNextScanStuck;      //Next scan never completes, for SCAN_TIMEOUT
+
+const std::vector<ScanCall>& scanCalls();
+const std::vector<BeginCall>& beginCalls();
+wifi_mode_t wifiMode();
+
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+//Host fake of the ESP-IDF log, printed only when EASYWIFI_TEST_LOG is set in the environment.
+//Arguments are still checked against the format, like on the device
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+__attribute__((format(printf, 3, 4)))
+inline void fakeLog(char level, const char *tag, const char *format, ...)
+{
+  static const bool isEnabled = getenv("EASYWIFI_TEST_LOG") != nullptr;
+  if(!isEnabled)
+    return;
+
+  va_list args;
+  va_start(args, format);
+  printf("%c (%s) ", level, tag);
+  vprintf(format, args);
+  printf("\n");
+  va_end(args);
+}
+
+#define ESP_LOGE(tag, ...) fakeLog('E', tag, __VA_ARGS__)
+#define ESP_LOGW(tag, ...) fakeLog('W', tag, __VA_ARGS__)
+#define ESP_LOGI(tag, ...) fakeLog('I', tag, __VA_ARGS__)
+#define ESP_LOGD(tag, ...) fakeLog('D', tag, __VA_ARGS__)
+#define ESP_LOGV(tag, ...) fakeLog('V', tag, __VA_ARGS__)
@@ -0,0 +1,4 @@
+#pragma once
+
+//Host fake, flash and RAM are the same memory here
+#define PROGMEM
@@ -0,0 +1,183 @@
+//Portal files served from LittleFS, built with EASYWIFI_LITTLEFS against a host directory
+
+#include "simulation.h"
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+#include <string>
+#include <vector>
+
+using namespace EASYWIFI;
+using namespace testing;
+
+//Files of one test in a fresh host directory, mounted as the LittleFS root and removed at the end
+class PortalFiles
+{
+  public:
+    PortalFiles()
+    {
+      strcpy(_root, "/tmp/easyWifiFs.XXXXXX");
+      if(mkdtemp(_root) == nullptr)
+        return;
+      mkdir((std::string(_root) + LITTLEFS_ROOT).c_str(), 0700);
+      fake::setFileSystemRoot(_root);
+    };
+
+    ~PortalFiles()
+    {
+      for(const std::string &file : _files)
+        unlink(file.c_str());
+      rmdir((std::string(_root) + LITTLEFS_ROOT).c_str());
+      rmdir(_root);
+    };
+
+    ///@return Content written to LITTLEFS_ROOT/name, length times fill
+    std::string add(const char *name, size_t length, char fill, time_t lastWrite)
+    {
+      std::string content(length, fill);
+      std::string file = std::string(_root) + LITTLEFS_ROOT + "/" + name;
+      FILE *host = fopen(file.c_str(), "wb");
+      fwrite(content.data(), 1, content.size(), host);
+      fclose(host);
+
+      struct utimbuf times = { lastWrite, lastWrite };
+      utime(file.c_str(), &times);
+      _files.push_back(file);
+      return content;
+    };
+
+  private:
+    char _root[32];
+    std::vector<std::string> _files;
+};
+
+static const time_t LAST_WRITE = 1700000000; //Tue, 14 Nov 2023 22:13:20 GMT
+
+TEST(filesAreServedFromRamAfterTheFirstLoad)
+{
+  PortalFiles files;
+  std::string page = files.add("index.htm", 1000, 'h', LAST_WRITE);
+  files.add("script.js", 3000, 's', LAST_WRITE);
+  std::string script = files.add("script.js.gz", 800, 'z', LAST_WRITE); //Preferred over the plain file
+  std::string style = files.add("style.css", 500, 'c', LAST_WRITE);
+
+  EasyWifi wifi;
+  wifi.setup();
+  const FileCache &cache = wifi.get_fileCache();
+
+  const struct { const char *url; const std::string &body; const char *mimeType; bool isGzip; } assets[] = {
+    {"/", page, "text/html", false}, {"/script.js", script, "text/javascript", true}, {"/style.css", style, "text/css", false},
+  };
+
+  //Same answers from flash and from the cache
+  std::string etags[3];
+  uint32_t opens = 0;
+  for(int load = 0; load < 2; load++)
+  {
+    for(int i = 0; i < 3; i++)
+    {
+      AsyncWebServerRequest request(HTTP_GET, assets[i].url);
+      AsyncWebServerResponse *response = handle(request);
+      if(!CHECK(response != nullptr))
+        return;
+      CHECK_EQ(response->code(), 200);
+      CHECK_STR(response->contentType().c_str(), assets[i].mimeType);
+      CHECK(response->body() == assets[i].body);
+      CHECK((response->header("Content-Encoding") != nullptr) == assets[i].isGzip);
+      CHECK_STR(response->header("Last-Modified"), "Tue, 14 Nov 2023 22:13:20 GMT");
+      if(load == 0)
+        etags[i] = response->header("ETag");
+      else
+        CHECK_STR(response->header("ETag"), etags[i].c_str());
+    }
+
+    if(load == 0)
+    {
+      CHECK_EQ(cache.get_misses(), 3);
+      CHECK_EQ(cache.get_hits(), 0);
+      opens = fake::fileOpens();
+    }
+  }
+  CHECK_EQ(cache.get_hits(), 3);
+  CHECK_EQ(cache.get_misses(), 3);
+  CHECK_EQ(cache.get_bytesReadFromFlash(), page.size() + script.size() + style.size());
+  CHECK_EQ(cache.get_bytesCached(), page.size() + script.size() + style.size());
+  CHECK_EQ(fake::fileOpens(), opens); //Second load never touched flash
+
+  AsyncWebServerRequest revalidate(HTTP_GET, "/script.js");
+  revalidate.withHeader("If-None-Match", etags[1].c_str());
+  AsyncWebServerResponse *response = handle(revalidate);
+  CHECK_EQ(response->code(), 304);
+  CHECK(response->body().empty());
+  CHECK_EQ(cache.get_hits(), 4);
+
+  AsyncWebServerRequest missing(HTTP_GET, "/missing.js");
+  response = handle(missing);
+  CHECK_EQ(response->code(), 200); //Not a portal file, the portal page is shown instead
+  CHECK(response->body() == page);
+}
+
+TEST(evictedFileStaysValidWhileSending)
+{
+  static_assert(FILE_CACHE_MAX_BYTES < 2 * 9000, "Two files must not fit in the cache");
+  PortalFiles files;
+  std::string first = files.add("first.js", 9000, '1', LAST_WRITE);
+  std::string second = files.add("second.js", 9000, '2', LAST_WRITE);
+
+  EasyWifi wifi;
+  wifi.setup();
+  const FileCache &cache = wifi.get_fileCache();
+
+  AsyncWebServerRequest sending(HTTP_GET, "/first.js");
+  AsyncWebServerResponse *inFlight = handle(sending); //Body not read yet, still on the wire
+  AsyncWebServerRequest evicting(HTTP_GET, "/second.js");
+  CHECK(handle(evicting)->body() == second);
+  CHECK_EQ(cache.get_bytesCached(), second.size());
+
+  CHECK(inFlight->body() == first);
+
+  AsyncWebServerRequest reload(HTTP_GET, "/first.js");
+  CHECK(handle(reload)->body() == first);
+  CHECK_EQ(cache.get_misses(), 3); //Evicted, so loaded again
+  CHECK_EQ(cache.get_hits(), 0);
+}
+
+TEST(bigFilesStreamWithValidatorsOfTheSentFile)
+{
+  PortalFiles files;
+  files.add("big.js", FILE_CACHE_MAX_BYTES + 1000, 'p', LAST_WRITE);
+  std::string gzip = files.add("big.js.gz", FILE_CACHE_MAX_BYTES + 500, 'z', LAST_WRITE + 60);
+
+  EasyWifi wifi;
+  wifi.setup();
+  const FileCache &cache = wifi.get_fileCache();
+
+  //Headers and body both describe the .gz file, the one actually sent
+  AsyncWebServerRequest request(HTTP_GET, "/big.js");
+  AsyncWebServerResponse *response = handle(request);
+  if(!CHECK(response != nullptr))
+    return;
+  CHECK_EQ(response->code(), 200);
+  CHECK(response->body() == gzip);
+  CHECK_STR(response->header("Content-Encoding"), "gzip");
+  CHECK_STR(response->contentType().c_str(), "text/javascript");
+  char etag[24];
+  snprintf(etag, sizeof(etag), "W/\"%08x-%08x\"", (unsigned int)gzip.size(), (unsigned int)(LAST_WRITE + 60));
+  CHECK_STR(response->header("ETag"), etag);
+  CHECK_STR(response->header("Last-Modified"), "Tue, 14 Nov 2023 22:14:20 GMT");
+  CHECK_EQ(cache.get_bytesCached(), 0);
+
+  AsyncWebServerRequest revalidate(HTTP_GET, "/big.js");
+  revalidate.withHeader("If-None-Match", etag);
+  response = handle(revalidate);
+  CHECK_EQ(response->code(), 304);
+  CHECK(response->body().empty());
+
+  AsyncWebServerRequest strong(HTTP_GET, "/big.js"); //Same tag without W/, still a match for If-None-Match
+  strong.withHeader("If-None-Match", etag + 2);
+  CHECK_EQ(handle(strong)->code(), 304);
+
+  AsyncWebServerRequest byDate(HTTP_GET, "/big.js");
+  byDate.withHeader("If-Modified-Since", "Tue, 14 Nov 2023 22:14:20 GMT");
+  CHECK_EQ(handle(byDate)->code(), 304);
+}
@@ -0,0 +1,120 @@
+//Portal /metrics route, built with EASYWIFI_METRICS_ROUTE
+
+#include "simulation.h"
+#include <limits.h>
+#include <map>
+#include <string>
+
+using namespace EASYWIFI;
+using namespace testing;
+
+//Just enough JSON for /metrics: nested objects of integers, flattened to "boot.setup" style keys
+class MetricsParser
+{
+  public:
+    explicit MetricsParser(const std::string &json) : _json(json) {};
+
+    ///@return False if json is not one object, with nothing after it
+    bool parse()
+    {
+      _position = 0;
+      return parseObject("") && _position == _json.size();
+    };
+
+    const std::map<std::string, long long>& values() const { return _values; };
+
+  private:
+    bool consume(char expected)
+    {
+      if(_position >= _json.size() || _json[_position] != expected)
+        return false;
+      _position++;
+      return true;
+    };
+
+    bool parseObject(const std::string &prefix)
+    {
+      if(!consume('{'))
+        return false;
+      if(consume('}'))
+        return true;
+      do
+      {
+        size_t start = _position + 1;
+        if(!consume('"'))
+          return false;
+        size_t end = _json.find('"', start);
+        if(end == std::string::npos)
+          return false;
+        std::string key = prefix + _json.substr(start, end - start);
+        _position = end + 1;
+        if(!consume(':'))
+          return false;
+
+        if(_position < _json.size() && _json[_position] == '{')
+        {
+          if(!parseObject(key + "."))
+            return false;
+        }
+        else
+        {
+          const char *number = _json.c_str() + _position;
+          char *numberEnd;
+          long long value = strtoll(number, &numberEnd, 10);
+          if(numberEnd == number || _values.count(key))
+            return false;
+          _values[key] = value;
+          _position += numberEnd - number;
+        }
+      } while(consume(','));
+      return consume('}');
+    };
+
+    const std::string &_json;
+    size_t _position = 0;
+    std::map<std::string, long long> _values;
+};
+
+TEST(everyCounterFitsAtItsWidest)
+{
+  EasyWifi wifi;
+  wifi.setup();
+
+  //Widest value of every field, the JSON is as long as it can get
+  EasyWifiMetrics &metrics = const_cast<EasyWifiMetrics&>(wifi.get_Metrics());
+  PhaseTiming *phases[] = { &metrics.scan, &metrics.connect, &metrics.portalStart, &metrics.nvsRead, &metrics.nvsWrite };
+  for(PhaseTiming *timing : phases)
+    timing->min = timing->max = timing->last = timing->count = UINT32_MAX;
+  uint32_t *boot[] = { &metrics.boot.setup, &metrics.boot.nvsRead, &metrics.boot.portalUp, &metrics.boot.firstScan, &metrics.boot.connected };
+  for(uint32_t *phase : boot)
+    *phase = UINT32_MAX;
+  for(uint32_t &requests : metrics.requests)
+    requests = UINT32_MAX - 1; //The /metrics request below counts itself
+  metrics.nvsWritesSkipped = metrics.failedConnects = metrics.minFreeHeap = UINT32_MAX;
+  metrics.roamScans = metrics.roams = metrics.failedRoams = UINT32_MAX;
+  metrics.rssiAverage = metrics.rssiMin = INT8_MIN;
+
+  AsyncWebServerRequest request(HTTP_GET, "/metrics");
+  AsyncWebServerResponse *response = handle(request);
+  if(!CHECK(response != nullptr))
+    return;
+  CHECK_EQ(response->code(), 200);
+  CHECK_STR(response->contentType().c_str(), "application/json");
+  report("/metrics at its widest: %u of %d bytes", (unsigned)response->body().size(), METRICS_JSON_MAX_LENGTH);
+
+  MetricsParser parser(response->body());
+  if(!CHECK(parser.parse()))
+    return;
+  const std::map<std::string, long long> &values = parser.values();
+  CHECK_EQ(values.size(), 5 * 4 + 5 + (size_t)ROUTE::COUNT + 4 + 5);
+
+  const char *phaseNames[] = { "scan", "connect", "portal_start", "nvs_read", "nvs_write" };
+  for(const char *name : phaseNames)
+    CHECK_EQ(values.at(std::string("timings.") + name + ".count"), (long long)UINT32_MAX);
+  CHECK_EQ(values.at("boot.connected"), (long long)UINT32_MAX);
+  for(uint8_t i = 0; i < (uint8_t)ROUTE::COUNT; i++)
+    CHECK_EQ(values.at(std::string("requests.") + toString((ROUTE)i)), (long long)(i == (uint8_t)ROUTE::METRICS ? UINT32_MAX : UINT32_MAX - 1));
+  CHECK_EQ(values.at("failed_connects"), (long long)UINT32_MAX);
+  CHECK_EQ(values.at("roaming.failed"), (long long)UINT32_MAX);
+  CHECK_EQ(values.at("roaming.rssi_min"), (long long)INT8_MIN);
+}
@@ -0,0 +1,411 @@
+//Portal routes, as a phone joined to the AP would hit them
+
+#include "simulation.h"
+#ifdef HAS_ZLIB
+  #include <zlib.h>
+#endif
+#include <string>
+#include <vector>
+
+using namespace EASYWIFI;
+using namespace testing;
+
+static bool hasScanFinished(EasyWifi &wifi)
+{
+  return wifi.get_ScanState() == SCAN_STATUS::FINISHED;
+}
+
+static uint32_t scanGeneration(EasyWifi &wifi)
+{
+  return wifi.readScanResults()->generation;
+}
+
+#ifdef HAS_ZLIB
+//What the browser gets after Content-Encoding: gzip
+static std::string gunzip(const std::string &data)
+{
+  z_stream stream = {};
+  inflateInit2(&stream, 16 + MAX_WBITS);
+  stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+  stream.avail_in = data.size();
+
+  std::string text;
+  char buffer[1024];
+  int result;
+  do
+  {
+    stream.next_out = reinterpret_cast<Bytef*>(buffer);
+    stream.avail_out = sizeof(buffer);
+    result = inflate(&stream, Z_NO_FLUSH);
+    text.append(buffer, sizeof(buffer) - stream.avail_out);
+  } while(result == Z_OK);
+  inflateEnd(&stream);
+  return result == Z_STREAM_END ? text : std::string();
+}
+#endif
+
+TEST(scanResultsAreCachedForTtl)
+{
+  addAccessPoint("home", 1, 6, -50, "homepass1");
+
+  EasyWifi wifi;
+  wifi.setup();
+  CHECK(runUntil(wifi, [&wifi]{ return hasScanFinished(wifi); }, 10000));
+  size_t scans = fake::scanCalls().size();
+
+  AsyncWebServerRequest fresh(HTTP_GET, "/start-scan");
+  handle(fresh);
+  runFor(wifi, 1000);
+  CHECK_EQ(fake::scanCalls().size(), scans); //Served from the cache, the radio stays on the AP
+
+  fake::advance(SCAN_DEFAULT_CACHE_TTL);
+  AsyncWebServerRequest expired(HTTP_GET, "/start-scan");
+  handle(expired);
+  runFor(wifi, 100);
+  CHECK_EQ(fake::scanCalls().size(), scans + 1);
+  CHECK(wifi.get_ScanState() == SCAN_STATUS::RUNNING);
+  CHECK(runUntil(wifi, [&wifi]{ return hasScanFinished(wifi); }, 10000));
+}
+
+TEST(assetsAreRevalidatedWithoutBody)
+{
+  EasyWifi wifi;
+  wifi.setup();
+
+  const struct { const char *url; const char *mimeType; const char *content; } assets[] = {
+    {"/", "text/html", "<html>"}, {"/script.js", "text/javascript", "/scan-status"}, {"/style.css", "text/css", "{"},
+  };
+  for(const auto &asset : assets)
+  {
+    AsyncWebServerRequest page(HTTP_GET, asset.url);
+    AsyncWebServerResponse *response = handle(page);
+    if(!CHECK(response != nullptr))
+      continue;
+    CHECK_EQ(response->code(), 200);
+    CHECK_STR(response->contentType().c_str(), asset.mimeType);
+    CHECK_STR(response->header("Content-Encoding"), "gzip");
+    CHECK_STR(response->header("Cache-Control"), "no-cache");
+#ifdef HAS_ZLIB
+    CHECK(gunzip(response->body()).find(asset.content) != std::string::npos);
+#endif
+    const char *etag = response->header("ETag");
+    if(!CHECK(etag != nullptr))
+      continue;
+
+    AsyncWebServerRequest again(HTTP_GET, asset.url);
+    again.withHeader("If-None-Match", etag);
+    AsyncWebServerResponse *notModified = handle(again);
+    if(!CHECK(notModified != nullptr))
+      continue;
+    CHECK_EQ(notModified->code(), 304);
+    CHECK(notModified->body().empty());
+    CHECK_STR(notModified->header("ETag"), etag);
+    CHECK(notModified->header("Content-Encoding") == nullptr);
+  }
+}
+
+TEST(ifNoneMatchComparesWholeTags)
+{
+  addAccessPoint("home", 1, 6, -50, "homepass1");
+
+  EasyWifi wifi;
+  wifi.setup();
+  CHECK(runUntil(wifi, [&wifi]{ return hasScanFinished(wifi); }, 10000));
+
+  const char *urls[] = { "/script.js", "/scan-status" }; //Validators of the static files and of the scan results
+  for(const char *url : urls)
+  {
+    AsyncWebServerRequest first(HTTP_GET, url);
+    AsyncWebServerResponse *response = handle(first);
+    if(!CHECK(response != nullptr && response->header("ETag") != nullptr))
+      continue;
+    std::string etag = response->header("ETag");
+    std::string bare = etag.substr(1, etag.size() - 2);
+
+    const struct { std::string header; int code; } cases[] = {
+      {etag, 304}, {"\"other\", " + etag, 304}, {"W/" + etag, 304}, {"*", 304}, {" \"other\" ,W/" + etag + " ", 304},
+      {"\"" + bare.substr(1) + "\"", 200}, {"\"" + bare + "0\"", 200}, {"\"x" + etag + "\"", 200},
+      {bare, 200}, {"\"" + bare, 200}, {"W/*", 200},
+    };
+    for(const auto &check : cases)
+    {
+      AsyncWebServerRequest again(HTTP_GET, url);
+      again.withHeader("If-None-Match", check.header.c_str());
+      response = handle(again);
+      if(CHECK(response != nullptr) && !CHECK_EQ(response->code(), check.code))
+        report("%s with If-None-Match: %s", url, check.header.c_str());
+    }
+  }
+}
+
+TEST(captiveProbesRedirectWithoutAllocating)
+{
+  EasyWifi wifi;
+  wifi.setup();
+
+  //Every OS gets the same redirect
+  const char *probes[] = { "/generate_204", "/gen_204", "/hotspot-detect.html", "/library/test/success.html",
+    "/connecttest.txt", "/ncsi.txt", "/redirect", "/canonical.html", "/success.txt" };
+  for(const char *path : probes)
+  {
+    AsyncWebServerRequest probe(HTTP_GET, path, "connectivitycheck.gstatic.com");
+    uint64_t before = fake::heap().allocations;
+    AsyncWebServerResponse *response = handle(probe);
+    CHECK_EQ(fake::heap().allocations - before, 0);
+    if(CHECK(response != nullptr))
+    {
+      CHECK_EQ(response->code(), 302);
+      CHECK_STR(response->header("Location"), "http://192.168.4.1/");
+    }
+  }
+  CHECK_EQ(wifi.get_Metrics().requests[(uint8_t)ROUTE::CAPTIVE_PROBE], sizeof(probes) / sizeof(probes[0]));
+
+  //Also at the portal address, probes are matched before anything is served there
+  AsyncWebServerRequest direct(HTTP_GET, "/generate_204");
+  CHECK_EQ(handle(direct)->code(), 302);
+
+  AsyncWebServerRequest elsewhere(HTTP_GET, "/news", "example.com");
+  AsyncWebServerResponse *response = handle(elsewhere);
+  if(CHECK(response != nullptr))
+    CHECK_EQ(response->code(), 302);
+
+  //Already at the portal, unknown paths show it instead of redirecting to itself
+  AsyncWebServerRequest unknown(HTTP_GET, "/nothing");
+  response = handle(unknown);
+  if(CHECK(response != nullptr))
+  {
+    CHECK_EQ(response->code(), 200);
+    CHECK_STR(response->contentType().c_str(), "text/html");
+  }
+}
+
+TEST(eventsFollowScanAndConnection)
+{
+  addAccessPoint("home", 1, 6, -50, "homepass1");
+
+  EasyWifi wifi;
+  wifi.setup();
+  AsyncEventSource *events = AsyncWebServer::running()->eventSource("/events");
+  if(!CHECK(events != nullptr))
+    return;
+  events->connectClient();
+
+  CHECK(runUntil(wifi, [&wifi]{ return hasScanFinished(wifi); }, 10000));
+
+  AsyncWebServerRequest submit(HTTP_POST, "/start-wifi");
+  submit.withParam("ssid", "home", true).withParam("password", "homepass1", true).withParam("isProtected", "1", true);
+  AsyncWebServerResponse *response = handle(submit);
+  const char *session = response ? response->header("X-Session") : nullptr;
+  if(!CHECK(session != nullptr))
+    return;
+  CHECK_EQ(response->code(), 200);
+
+  //Only the client that submitted reads the result
+  AsyncWebServerRequest own(HTTP_GET, "/wifi-status");
+  own.withParam("session", session);
+  AsyncWebServerRequest other(HTTP_GET, "/wifi-status");
+  other.withParam("session", "12345678");
+  CHECK_EQ(handle(own)->code(), 202);
+  CHECK_EQ(handle(other)->code(), 410);
+
+  CHECK(runUntil(wifi, [&wifi]{ return wifi.get_WifiState() == WIFI_STATUS::CONNECTED; }, 10000));
+  AsyncWebServerRequest result(HTTP_GET, "/wifi-status");
+  result.withParam("session", session);
+  CHECK_EQ(handle(result)->code(), 200);
+
+  const struct { const char *event; const char *data; } expected[] = {
+    {"scan", "READY_TO_SCAN"}, {"wifi", "IDLE"}, //Current state on connect
+    {"scan", "RUNNING"}, {"networks", nullptr}, {"scan", "FINISHED"},
+    {"wifi", "CONNECTING"}, {"wifi", "CONNECTED"},
+  };
+  std::vector<AsyncEventSource::Event> sent = events->sent(); //Copied, the server goes away with the portal
+  if(CHECK_EQ(sent.size(), sizeof(expected) / sizeof(expected[0])))
+  {
+    for(size_t i = 0; i < sent.size(); i++)
+    {
+      CHECK_STR(sent[i].event.c_str(), expected[i].event);
+      if(expected[i].data)
+        CHECK_STR(sent[i].data.c_str(), expected[i].data);
+    }
+    CHECK(sent[3].data.find("\"ssid\":\"home\"") != std::string::npos);
+    CHECK_EQ(sent[3].id, 1); //Scan generation
+  }
+
+  runFor(wifi, PORTAL_LOGOUT_DELAY + 100);
+  CHECK(AsyncWebServer::running() == nullptr);
+  CHECK(fake::wifiMode() == WIFI_STA);
+}
+
+TEST(concurrentClientsShareOneScan)
+{
+  addAccessPoint("home", 1, 6, -50, "homepass1");
+
+  EasyWifi wifi;
+  wifi.setup();
+  CHECK(runUntil(wifi, [&wifi]{ return hasScanFinished(wifi); }, 10000));
+  size_t scans = fake::scanCalls().size();
+
+  //Three phones ask for a rescan in the same update() period
+  fake::advance(SCAN_DEFAULT_CACHE_TTL);
+  for(int i = 0; i < 3; i++)
+  {
+    AsyncWebServerRequest rescan(HTTP_GET, "/start-scan");
+    handle(rescan);
+  }
+  runFor(wifi, 100);
+  CHECK(wifi.get_ScanState() == SCAN_STATUS::RUNNING);
+  CHECK(runUntil(wifi, [&wifi]{ return hasScanFinished(wifi); }, 10000));
+  CHECK_EQ(fake::scanCalls().size(), scans + 1);
+
+  AsyncWebServerRequest first(HTTP_GET, "/scan-status");
+  AsyncWebServerRequest second(HTTP_GET, "/scan-status");
+  std::string etag = handle(first)->header("ETag");
+  CHECK_STR(handle(second)->header("ETag"), etag.c_str());
+}
+
+TEST(rescanKeepsServingLastResults)
+{
+  addAccessPoint("home", 1, 6, -50, "homepass1");
+
+  EasyWifi wifi;
+  wifi.setup();
+
+  AsyncWebServerRequest early(HTTP_GET, "/scan-status");
+  AsyncWebServerResponse *response = handle(early);
+  CHECK_EQ(response->code(), 202); //Nothing scanned yet
+  CHECK_STR(response->contentType().c_str(), "text/plain");
+
+  CHECK(runUntil(wifi, [&wifi]{ return hasScanFinished(wifi); }, 10000));
+  AsyncWebServerRequest first(HTTP_GET, "/scan-status");
+  response = handle(first);
+  CHECK_EQ(response->code(), 200);
+  CHECK(response->body().find("\"home\"") != std::string::npos);
+  CHECK_STR(response->header("X-Scan-Generation"), "1");
+  std::string etag = response->header("ETag") ? response->header("ETag") : "";
+
+  AsyncWebServerRequest cached(HTTP_GET, "/scan-status");
+  cached.withHeader("If-None-Match", etag.c_str());
+  response = handle(cached);
+  CHECK_EQ(response->code(), 304);
+  CHECK(response->body().empty());
+
+  //Results expire, the list stays on screen while the new scan runs
+  addAccessPoint("cafe", 2, 1, -60);
+  fake::advance(SCAN_DEFAULT_CACHE_TTL);
+  AsyncWebServerRequest expired(HTTP_GET, "/scan-status");
+  response = handle(expired);
+  CHECK_EQ(response->code(), 202);
+  CHECK_STR(response->contentType().c_str(), "application/json");
+  CHECK(response->body().find("\"home\"") != std::string::npos);
+  CHECK(response->body().find("\"cafe\"") == std::string::npos);
+
+  runFor(wifi, 100);
+  CHECK(wifi.get_ScanState() == SCAN_STATUS::RUNNING);
+  AsyncWebServerRequest running(HTTP_GET, "/scan-status");
+  response = handle(running);
+  CHECK_EQ(response->code(), 202);
+  CHECK_STR(response->header("X-Scan-Generation"), "1");
+  CHECK(response->body().find("\"home\"") != std::string::npos);
+
+  AsyncWebServerRequest upToDate(HTTP_GET, "/scan-status");
+  upToDate.withParam("since", "1");
+  response = handle(upToDate);
+  CHECK_EQ(response->code(), 202);
+  CHECK_STR(response->contentType().c_str(), "text/plain"); //Client already shows generation 1
+
+  CHECK(runUntil(wifi, [&wifi]{ return hasScanFinished(wifi); }, 10000));
+  AsyncWebServerRequest delta(HTTP_GET, "/scan-status");
+  delta.withParam("since", "1");
+  response = handle(delta);
+  CHECK_EQ(response->code(), 200);
+  CHECK_STR(response->header("X-Scan-Generation"), "2");
+  CHECK(response->header("ETag") == nullptr);
+  CHECK_STR(response->body().c_str(), "{\"added\":[{\"ssid\":\"cafe\",\"rssi\":-60,\"isProtected\":0,\"aps\":1}],\"changed\":[],\"removed\":[]}");
+}
+
+TEST(responseKeepsItsSnapshot)
+{
+  addAccessPoint("home", 1, 6, -50, "homepass1");
+
+  EasyWifi wifi;
+  wifi.setup();
+  CHECK(runUntil(wifi, [&wifi]{ return hasScanFinished(wifi); }, 10000));
+
+  //Still streaming while a new scan is published
+  AsyncWebServerRequest slow(HTTP_GET, "/scan-status");
+  AsyncWebServerResponse *response = handle(slow);
+
+  addAccessPoint("cafe", 2, 1, -60);
+  fake::advance(SCAN_DEFAULT_CACHE_TTL);
+  AsyncWebServerRequest rescan(HTTP_GET, "/start-scan");
+  handle(rescan);
+  CHECK(runUntil(wifi, [&wifi]{ return scanGeneration(wifi) == 2; }, 10000));
+
+  if(CHECK(response != nullptr))
+  {
+    CHECK_STR(response->header("X-Scan-Generation"), "1");
+    CHECK_STR(response->body().c_str(), "[{\"ssid\":\"home\",\"rssi\":-50,\"isProtected\":1,\"aps\":1}]");
+  }
+
+  AsyncWebServerRequest fresh(HTTP_GET, "/scan-status");
+  response = handle(fresh);
+  CHECK(response->body().find("\"cafe\"") != std::string::npos);
+}
+
+TEST(heldScanDelaysTheNextPublish)
+{
+  addAccessPoint("home", 1, 6, -50, "homepass1");
+
+  EasyWifi wifi;
+  wifi.setup();
+  CHECK(runUntil(wifi, [&wifi]{ return hasScanFinished(wifi); }, 10000));
+
+  {
+    AsyncWebServerRequest slow(HTTP_GET, "/scan-status"); //Holds generation 1 until it goes out of scope
+    handle(slow);
+
+    addAccessPoint("cafe", 2, 1, -60);
+    fake::advance(SCAN_DEFAULT_CACHE_TTL);
+    AsyncWebServerRequest rescan(HTTP_GET, "/start-scan");
+    handle(rescan);
+    CHECK(runUntil(wifi, [&wifi]{ return scanGeneration(wifi) == 2; }, 10000));
+
+    //Generation 3 goes into the slot slow still sends, so it waits with the scan RUNNING
+    fake::advance(SCAN_DEFAULT_CACHE_TTL);
+    AsyncWebServerRequest again(HTTP_GET, "/start-scan");
+    handle(again);
+    runFor(wifi, 10000);
+    CHECK(wifi.get_ScanState() == SCAN_STATUS::RUNNING);
+    CHECK_EQ(scanGeneration(wifi), 2);
+
+    AsyncWebServerRequest meanwhile(HTTP_GET, "/scan-status");
+    AsyncWebServerResponse *response = handle(meanwhile);
+    CHECK_EQ(response->code(), 202);
+    CHECK(response->body().find("\"cafe\"") != std::string::npos);
+    CHECK(slow.response()->body().find("\"cafe\"") == std::string::npos); //Its slot was left as it was
+  }
+
+  CHECK(runUntil(wifi, [&wifi]{ return hasScanFinished(wifi); }, 1000));
+  CHECK_EQ(scanGeneration(wifi), 3);
+}
+
+TEST(startStopLeaksNothing)
+{
+  EasyWifi wifi;
+  wifi.setup();
+  wifi.logoutCaptivePortal();
+  wifi.startCaptivePortal();
+  int64_t liveBytes = fake::heap().liveBytes;
+  uint64_t allocations = fake::heap().allocations;
+
+  const int cycles = 10000;
+  for(int i = 0; i < cycles; i++)
+  {
+    wifi.logoutCaptivePortal();
+    wifi.startCaptivePortal();
+  }
+
+  CHECK(AsyncWebServer::running() != nullptr);
+  CHECK_EQ(fake::heap().liveBytes, liveBytes);
+  report("%.1f allocations per portal start", (double)(fake::heap().allocations - allocations) / cycles);
+}
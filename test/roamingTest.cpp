@@ -0,0 +1,129 @@
+//Roaming decisions on scripted RSSI traces, then a whole roam between two APs
+
+#include "simulation.h"
+#include <vector>
+
+using namespace EASYWIFI;
+using namespace testing;
+
+//Feeds one sample per ROAMING_SAMPLE_INTERVAL, @return times a scan would have started
+static int replay(RoamingPolicy &policy, const std::vector<int8_t> &trace, unsigned long &now)
+{
+  int scans = 0;
+  for(int8_t rssi : trace)
+  {
+    now += ROAMING_SAMPLE_INTERVAL;
+    policy.sample(rssi);
+    if(policy.isScanDue(now))
+    {
+      policy.scanStarted(now);
+      scans++;
+    }
+  }
+  return scans;
+}
+
+TEST(steadyLinkNeverScans)
+{
+  RoamingPolicy policy;
+  unsigned long now = 0;
+  CHECK_EQ(replay(policy, std::vector<int8_t>(600, -60), now), 0);
+  CHECK_EQ(policy.get_averageRssi(), -60);
+}
+
+TEST(singleDipNeverScans)
+{
+  RoamingPolicy policy;
+  unsigned long now = 0;
+  std::vector<int8_t> trace(20, -65);
+  trace[10] = -95;
+  CHECK_EQ(replay(policy, trace, now), 0);
+}
+
+TEST(fewSamplesNeverScan)
+{
+  RoamingPolicy policy;
+  unsigned long now = 0;
+  CHECK_EQ(replay(policy, std::vector<int8_t>(ROAMING_MIN_SAMPLES - 1, -90), now), 0);
+  CHECK_EQ(replay(policy, std::vector<int8_t>(1, -90), now), 1);
+}
+
+TEST(weakLinkScansOncePerInterval)
+{
+  RoamingPolicy policy;
+  unsigned long now = 0;
+  //Walking away from the AP, then staying weak for 3 minutes
+  std::vector<int8_t> trace;
+  for(int8_t rssi = -60; rssi > -85; rssi--)
+    trace.push_back(rssi);
+  trace.insert(trace.end(), 180, -85);
+
+  CHECK_EQ(replay(policy, trace, now), 4); //Once weak, then every ROAMING_SCAN_INTERVAL
+  CHECK(policy.get_averageRssi() <= -84);
+}
+
+TEST(hysteresisAvoidsPingPong)
+{
+  RoamingPolicy policy;
+  policy.set_Policy(-70, 10, 30000);
+  unsigned long now = 0;
+  replay(policy, std::vector<int8_t>(10, -80), now);
+
+  CHECK(!policy.isBetter(-75)); //Better, but not by enough
+  CHECK(!policy.isBetter(-71));
+  CHECK(policy.isBetter(-70));
+
+  policy.restart(); //New link
+  CHECK(!policy.isBetter(0));
+}
+
+TEST(movesToStrongerApOfSameNetwork)
+{
+  addAccessPoint("home", 1, 1, -55, "homepass1"); //Living room
+  addAccessPoint("home", 2, 11, -70, "homepass1"); //Bedroom
+
+  EasyWifi wifi;
+  wifi.addCredential("home", "homepass1");
+  wifi.set_Roaming(true);
+  wifi.setup();
+  CHECK(runUntil(wifi, [&wifi]{ return wifi.get_WifiState() == WIFI_STATUS::CONNECTED; }, 20000));
+  CHECK_EQ(WiFi.channel(), 1);
+
+  //Walk to the bedroom
+  findAccessPoint(1)->rssi = -85;
+  findAccessPoint(2)->rssi = -55;
+  CHECK(runUntil(wifi, [&wifi]{ return wifi.get_Metrics().roams == 1; }, 30000));
+  CHECK_EQ(WiFi.BSSID()[5], 2);
+  CHECK_EQ(wifi.get_credential(0).channel, 11); //Next boot joins it directly
+  CHECK_EQ(wifi.get_Metrics().roamScans, 1);
+  CHECK_EQ(wifi.get_Metrics().failedRoams, 0);
+
+  //Both get weak, the other one stays too close to be worth a move
+  findAccessPoint(2)->rssi = -80;
+  findAccessPoint(1)->rssi = -76;
+  runFor(wifi, 3 * ROAMING_SCAN_INTERVAL);
+  CHECK(wifi.get_Metrics().roamScans >= 2);
+  CHECK_EQ(wifi.get_Metrics().roams, 1);
+  CHECK_EQ(WiFi.BSSID()[5], 2);
+}
+
+TEST(failedRoamFallsBackToNetwork)
+{
+  addAccessPoint("home", 1, 1, -55, "homepass1");
+  addAccessPoint("home", 2, 11, -70, "homepass1");
+
+  EasyWifi wifi;
+  wifi.addCredential("home", "homepass1");
+  wifi.set_Roaming(true);
+  wifi.setup();
+  CHECK(runUntil(wifi, [&wifi]{ return wifi.get_WifiState() == WIFI_STATUS::CONNECTED; }, 20000));
+
+  findAccessPoint(1)->rssi = -85;
+  findAccessPoint(2)->rssi = -55;
+  CHECK(runUntil(wifi, [&wifi]{ return wifi.get_Metrics().roamScans == 1; }, 30000));
+  findAccessPoint(2)->channel = 6; //Gone from where the scan saw it before the join
+
+  CHECK(runUntil(wifi, [&wifi]{ return wifi.get_Metrics().failedRoams == 1; }, 10000));
+  CHECK(runUntil(wifi, [&wifi]{ return wifi.get_WifiState() == WIFI_STATUS::CONNECTED; }, 10000));
+  CHECK_EQ(wifi.get_Metrics().roams, 0);
+}
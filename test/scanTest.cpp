@@ -0,0 +1,155 @@
+//Scan table and the JSON streamed from it
+
+#include "testing.h"
+#include <easyWifiJson.h>
+#include <string>
+
+using namespace EASYWIFI;
+
+static const uint8_t BSSID[6] = {0x24, 0x0a, 0xc4, 0x00, 0x00, 0x01};
+
+//Whole array as a client receives it, maxLen bytes per chunk
+static std::string stream(const ScanTable &table, size_t maxLen)
+{
+  ScanJsonWriter writer(table);
+  std::string json;
+  uint8_t buffer[4096];
+  size_t length;
+  while((length = writer.write(buffer, maxLen)) != 0)
+    json.append(reinterpret_cast<const char*>(buffer), length);
+  return json;
+}
+
+static void fill(ScanTable &table, uint8_t count)
+{
+  char ssid[SSID_MAX_LENGTH + 1];
+  for(uint8_t i = 0; i < count; i++)
+  {
+    snprintf(ssid, sizeof(ssid), "network-%02u", i);
+    table.add(ssid, -30 - i, BSSID, 1 + i % 13, i % 2);
+  }
+  table.sort();
+}
+
+TEST(tableKeepsStrongestApPerSsid)
+{
+  ScanTable table;
+  CHECK(table.add("mesh", -70, BSSID, 1, true));
+  CHECK(table.add("cafe", -60, BSSID, 6, false));
+  CHECK(table.add("mesh", -50, BSSID, 11, true));
+  CHECK(!table.add("", -20, BSSID, 3, false)); //Hidden
+  table.sort();
+
+  CHECK_EQ(table.count(), 2);
+  CHECK_STR(table.get(0).ssid, "mesh");
+  CHECK_EQ(table.get(0).rssi, -50);
+  CHECK_EQ(table.get(0).channel, 11);
+  CHECK_EQ(table.get(0).apCount, 2);
+  CHECK_EQ(table.find("cafe"), 1);
+  CHECK_EQ(table.find("nowhere"), -1);
+}
+
+TEST(fullTableDropsWeakest)
+{
+  ScanTable table;
+  fill(table, SCAN_MAX_ENTRIES); //Weakest is network-31 at -61
+  CHECK(!table.add("weaker", -90, BSSID, 1, false));
+  CHECK(table.add("stronger", -20, BSSID, 1, false));
+  table.sort();
+
+  CHECK_EQ(table.count(), SCAN_MAX_ENTRIES);
+  CHECK_STR(table.get(0).ssid, "stronger");
+  CHECK_EQ(table.find("network-31"), -1);
+}
+
+TEST(contentHashFollowsWhatIsRendered)
+{
+  ScanTable a, b;
+  fill(a, 5);
+  fill(b, 5);
+  CHECK_EQ(a.contentHash(), b.contentHash());
+
+  b.clear();
+  fill(b, 4);
+  b.add("network-04", -33, BSSID, 5, false); //Same networks, one signal moved
+  b.sort();
+  CHECK(a.contentHash() != b.contentHash());
+}
+
+TEST(jsonIsTheSameForAnyChunkSize)
+{
+  ScanTable table;
+  table.add("home", -40, BSSID, 6, true);
+  table.add("cafe", -70, BSSID, 1, false);
+  table.sort();
+
+  const char *expected = "[{\"ssid\":\"home\",\"rssi\":-40,\"isProtected\":1,\"aps\":1},"
+                         "{\"ssid\":\"cafe\",\"rssi\":-70,\"isProtected\":0,\"aps\":1}]";
+  CHECK_STR(stream(table, 4096).c_str(), expected);
+  CHECK_STR(stream(table, 1).c_str(), expected);
+  CHECK_STR(stream(table, 7).c_str(), expected);
+
+  ScanTable empty;
+  CHECK_STR(stream(empty, 1).c_str(), "[]");
+
+  ScanTable full;
+  fill(full, SCAN_MAX_ENTRIES);
+  CHECK(stream(full, 64) == stream(full, 4096));
+}
+
+TEST(ssidsAreEscaped)
+{
+  char out[JSON_ENTRY_MAX_LENGTH];
+  ScanJsonWriter::escapeString("a\"b\\c\x01", out, sizeof(out));
+  CHECK_STR(out, "a\\\"b\\\\c\\u0001");
+
+  //Worst case SSID still renders whole
+  ScanEntry entry = {};
+  memset(entry.ssid, 0x1f, SSID_MAX_LENGTH);
+  entry.rssi = -128;
+  entry.isProtected = true;
+  entry.apCount = 255;
+  size_t length = ScanJsonWriter::renderNetwork(entry, out, sizeof(out));
+  CHECK_EQ(length, strlen(out));
+  CHECK(length + 2 < JSON_ENTRY_MAX_LENGTH); //Room for the separator and the closing bracket
+  CHECK_STR(out + length - 4, "255}");
+}
+
+TEST(streamingAllocatesNothing)
+{
+  ScanTable table;
+  fill(table, SCAN_MAX_ENTRIES);
+  uint8_t buffer[64];
+
+  uint64_t before = fake::heap().allocations;
+  ScanJsonWriter writer(table);
+  size_t total = 0;
+  size_t length;
+  while((length = writer.write(buffer, sizeof(buffer))) != 0)
+    total += length;
+
+  CHECK(total > SCAN_MAX_ENTRIES * 40);
+  CHECK_EQ(fake::heap().allocations - before, 0);
+}
+
+TEST(deltaListsWhatChanged)
+{
+  ScanTable previous, current;
+  previous.add("kept", -50, BSSID, 1, true);
+  previous.add("moved", -60, BSSID, 1, true);
+  previous.add("gone", -70, BSSID, 1, false);
+  current.add("kept", -50, BSSID, 1, true);
+  current.add("moved", -45, BSSID, 1, true);
+  current.add("new", -80, BSSID, 1, false);
+
+  char out[512];
+  size_t length = ScanJsonWriter::writeDelta(current, previous, out, sizeof(out));
+  CHECK_EQ(length, strlen(out));
+  CHECK_STR(out, "{\"added\":[{\"ssid\":\"new\",\"rssi\":-80,\"isProtected\":0,\"aps\":1}],"
+                 "\"changed\":[{\"ssid\":\"moved\",\"rssi\":-45,\"isProtected\":1,\"aps\":1}],"
+                 "\"removed\":[\"gone\"]}");
+
+  CHECK_EQ(ScanJsonWriter::writeDelta(current, previous, out, 40), 0); //Doesn't fit, full list instead
+  CHECK(ScanJsonWriter::writeDelta(current, current, out, sizeof(out)) != 0);
+  CHECK_STR(out, "{\"added\":[],\"changed\":[],\"removed\":[]}");
+}
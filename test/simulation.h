@@ -0,0 +1,58 @@
+#pragma once
+
+//Helpers shared by the tests that run a whole EasyWifi against the fakes
+
+#include "testing.h"
+#include <easyWifi.h>
+#include <ESPAsyncWebServer.h>
+
+namespace testing{
+
+///@param id Last byte of the BSSID, the others are the same for every AP
+inline void addAccessPoint(const char *ssid, uint8_t id, uint8_t channel, int8_t rssi, const char *password = "")
+{
+  fake::AccessPoint accessPoint = { ssid, {0x24, 0x0a, 0xc4, 0x00, 0x00, id}, channel, rssi, password };
+  fake::addAccessPoint(accessPoint);
+}
+
+inline fake::AccessPoint* findAccessPoint(uint8_t id)
+{
+  const uint8_t bssid[6] = {0x24, 0x0a, 0xc4, 0x00, 0x00, id};
+  return fake::findAccessPoint(bssid);
+}
+
+//Calls update() every step ms for duration ms, like loop() would
+inline void runFor(EASYWIFI::EasyWifi &wifi, unsigned long duration, unsigned long step = 10)
+{
+  for(unsigned long elapsed = 0; elapsed < duration; elapsed += step)
+  {
+    fake::advance(step);
+    wifi.update();
+  }
+}
+
+///@return False if timeout ms went by first
+template<typename Condition>
+bool runUntil(EASYWIFI::EasyWifi &wifi, Condition isDone, unsigned long timeout, unsigned long step = 10)
+{
+  for(unsigned long elapsed = 0; elapsed < timeout; elapsed += step)
+  {
+    if(isDone())
+      return true;
+    fake::advance(step);
+    wifi.update();
+  }
+  return isDone();
+}
+
+//Hands the request to the portal as the async_tcp task would, nullptr if the portal is closed or nothing was sent
+inline AsyncWebServerResponse* handle(AsyncWebServerRequest &request)
+{
+  AsyncWebServer *server = AsyncWebServer::running();
+  if(server == nullptr)
+    return nullptr;
+  server->handle(request);
+  return request.response();
+}
+
+};
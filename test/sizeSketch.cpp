@@ -0,0 +1,25 @@
+//Smallest real use of the library, linked once per configuration by the sizeReport target.
+//Also run as a test, so the minimal configuration is known to still open its portal.
+
+#include "simulation.h"
+
+using namespace EASYWIFI;
+using namespace testing;
+
+TEST(sketch)
+{
+  addAccessPoint("home", 1, 6, -55, "homepass1");
+  fake::setMillis(1000);
+
+  easyWifi.setup(); //Nothing stored, goes to the portal
+  CHECK(runUntil(easyWifi, []{ return AsyncWebServer::running() != nullptr; }, 5000));
+
+  AsyncWebServerRequest page(HTTP_GET, "/");
+  handle(page);
+  CHECK(page.response() && page.response()->code() == 200);
+
+  AsyncWebServerRequest submit(HTTP_POST, "/start-wifi");
+  submit.withParam("ssid", "home", true).withParam("password", "homepass1", true).withParam("isProtected", "1", true);
+  handle(submit);
+  CHECK(runUntil(easyWifi, []{ return easyWifi.get_WifiState() == WIFI_STATUS::CONNECTED; }, 20000));
+}
@@ -0,0 +1,26 @@
+# Prints what the minimal configuration saves over the default one, run by the sizeReport target.
+#   cmake -DSIZE=size -DDEFAULT=<exe> -DMINIMAL=<exe> -P size_report.cmake
+
+function(read_size file prefix)
+  execute_process(COMMAND ${SIZE} -B ${file} OUTPUT_VARIABLE output RESULT_VARIABLE result)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${SIZE} failed on ${file}")
+  endif()
+  string(REGEX MATCH "\n *([0-9]+)[ \t]+([0-9]+)[ \t]+([0-9]+)" row "${output}")
+  set(${prefix}_text ${CMAKE_MATCH_1} PARENT_SCOPE)
+  set(${prefix}_data ${CMAKE_MATCH_2} PARENT_SCOPE)
+  set(${prefix}_bss ${CMAKE_MATCH_3} PARENT_SCOPE)
+endfunction()
+
+read_size(${DEFAULT} default)
+read_size(${MINIMAL} minimal)
+
+foreach(config default minimal)
+  message("${config}: ${${config}_text} B text, ${${config}_data} B data, ${${config}_bss} B bss")
+endforeach()
+
+foreach(section text data bss)
+  math(EXPR saved "${default_${section}} - ${minimal_${section}}")
+  set(saved_${section} ${saved})
+endforeach()
+message("saved:   ${saved_text} B text, ${saved_data} B data, ${saved_bss} B bss")
@@ -0,0 +1,111 @@
+//EASYWIFI_TASK: update() runs on its own task while loop() and the web server task call into the library
+
+#include "simulation.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace EASYWIFI;
+using namespace testing;
+
+//Stops the easyWifi task before the EasyWifi it runs goes out of scope
+class TaskGuard
+{
+  public:
+    ~TaskGuard() { fake::stopTasks(); };
+};
+
+///@return False if timeout ms of simulated time, moved by the task, went by first
+template<typename Condition>
+static bool waitFor(Condition isDone, unsigned long timeout)
+{
+  unsigned long start = millis();
+  std::chrono::steady_clock::time_point realStart = std::chrono::steady_clock::now();
+  while(!isDone())
+  {
+    if(millis() - start > timeout || std::chrono::steady_clock::now() - realStart > std::chrono::seconds(20))
+      return false;
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+  return true;
+}
+
+//A body that is cut or mixed from two scans doesn't parse as one list
+static bool isWholeList(const std::string &body)
+{
+  return body.size() >= 2 && body.front() == '[' && body.back() == ']' && body.find("][") == std::string::npos;
+}
+
+TEST(setupStartsTheTask)
+{
+  addAccessPoint("home", 1, 6, -50, "homepass1");
+
+  EasyWifi wifi;
+  TaskGuard guard;
+  wifi.setup();
+  CHECK_EQ(fake::taskCount(), 1);
+  CHECK_STR(fake::lastTask().name, "easyWifi");
+  CHECK_EQ(fake::lastTask().stackDepth, EASYWIFI_TASK_STACK);
+  CHECK_EQ(fake::lastTask().core, EASYWIFI_TASK_CORE);
+
+  //Nothing stored, the portal scans on the task alone
+  CHECK(waitFor([&wifi]{ return wifi.get_ScanState() == SCAN_STATUS::FINISHED; }, 10000));
+
+  //Left in loop(), it returns without touching anything
+  size_t scans = fake::scanCalls().size();
+  wifi.update();
+  CHECK_EQ(fake::scanCalls().size(), scans);
+}
+
+TEST(publicMethodsRunBesideTheTask)
+{
+  addAccessPoint("home", 1, 6, -50, "homepass1");
+  addAccessPoint("cafe", 2, 1, -60);
+
+  EasyWifi wifi;
+  TaskGuard guard;
+  std::atomic<int> results{0};
+  std::atomic<bool> isOnTask{false};
+  wifi.onConnectionResult([&](WIFI_STATUS status){
+    isOnTask = xTaskGetCurrentTaskHandle() != nullptr;
+    wifi.set_ConnectTimeout(WIFI_CONNECT_TIMEOUT); //State lock is held already, taken again without deadlock
+    if(status == WIFI_STATUS::CONNECTED)
+      results++;
+  });
+  wifi.setup();
+
+  //loop() and the web server task keep calling in while the task scans over and over
+  uint32_t generation = 0;
+  int lists = 0;
+  for(int i = 0; i < 2000 && generation < 5; i++)
+  {
+    wifi.set_ScanCacheTTL(50 + i % 2);
+    ScanChannel channels[2] = { {1, false, 60}, {6, false, 60} };
+    wifi.set_ScanChannels(channels, 2);
+    CHECK_EQ(wifi.get_credentialCount(), 0);
+
+    AsyncWebServerRequest rescan(HTTP_GET, "/start-scan");
+    handle(rescan);
+    AsyncWebServerRequest scan(HTTP_GET, "/scan-status");
+    AsyncWebServerResponse *response = handle(scan);
+    if(!CHECK(response != nullptr))
+      return;
+    if(response->code() == 200)
+    {
+      CHECK(isWholeList(response->body()));
+      lists++;
+    }
+    generation = wifi.readScanResults()->generation;
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+  }
+  CHECK(generation >= 5);
+  CHECK(lists > 0);
+
+  AsyncWebServerRequest connect(HTTP_POST, "/start-wifi");
+  connect.withParam("ssid", "home", true).withParam("password", "homepass1", true).withParam("isProtected", "1", true);
+  handle(connect);
+  CHECK(waitFor([&wifi]{ return wifi.get_WifiState() == WIFI_STATUS::CONNECTED; }, 20000));
+  CHECK(waitFor([&results]{ return results == 1; }, 1000));
+  CHECK(isOnTask);
+  CHECK_EQ(wifi.get_credentialCount(), 1);
+}
@@ -0,0 +1,107 @@
+//testing.cpp - runner of the host tests
+
+#include "testing.h"
+#include <ESPAsyncWebServer.h>
+#include <AsyncUDP.h>
+#include <FS.h>
+#include <stdarg.h>
+#include <vector>
+
+namespace testing{
+
+struct Test
+{
+  const char *name;
+  TestFunction function;
+};
+
+static std::vector<Test>& tests()
+{
+  static std::vector<Test> registered; //Filled by static constructors, before main()
+  return registered;
+}
+
+static uint32_t failures = 0;
+
+Registration::Registration(const char *name, TestFunction function)
+{
+  fake::HeapPause pause;
+  tests().push_back({ name, function });
+}
+
+bool check(bool condition, const char *expression, const char *file, int line)
+{
+  if(!condition)
+  {
+    printf("  %s:%d: CHECK(%s) failed\n", file, line, expression);
+    failures++;
+  }
+  return condition;
+}
+
+bool checkEqual(long long actual, long long expected, const char *expression, const char *file, int line)
+{
+  if(actual != expected)
+  {
+    printf("  %s:%d: CHECK_EQ(%s) failed, got %lld expected %lld\n", file, line, expression, actual, expected);
+    failures++;
+  }
+  return actual == expected;
+}
+
+bool checkString(const char *actual, const char *expected, const char *expression, const char *file, int line)
+{
+  bool isEqual = actual != nullptr && strcmp(actual, expected) == 0;
+  if(!isEqual)
+  {
+    printf("  %s:%d: CHECK_STR(%s) failed, got \"%s\" expected \"%s\"\n", file, line, expression, actual ? actual : "(null)", expected);
+    failures++;
+  }
+  return isEqual;
+}
+
+void report(const char *format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  printf("  ");
+  vprintf(format, args);
+  printf("\n");
+  va_end(args);
+}
+
+};
+
+int main(int argc, char **argv)
+{
+  using namespace testing;
+  const char *only = argc > 1 ? argv[1] : nullptr; //Runs a single test by name
+
+  uint32_t run = 0;
+  uint32_t failed = 0;
+  for(const Test &test : tests())
+  {
+    if(only && strcmp(only, test.name) != 0)
+      continue;
+
+    fake::resetClock();
+    fake::resetWiFi();
+    fake::resetNvs();
+    fake::resetWebServer();
+    fake::resetUdp();
+    fake::resetFileSystem();
+
+    printf("[ RUN  ] %s\n", test.name);
+    uint32_t before = failures;
+    test.function();
+    bool isPassed = failures == before;
+    printf("[ %s ] %s\n", isPassed ? " OK " : "FAIL", test.name);
+
+    run++;
+    if(!isPassed)
+      failed++;
+  }
+
+  printf("%u tests, %u failed\n", run, failed);
+  return failed == 0 && run > 0 ? 0 : 1;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+/*
+*   Minimal test runner for the host build, one executable per test file.
+*   Every TEST starts from a clean simulation: clock at boot, empty air, empty NVS, no server running,
+*   no file system mounted.
+*   CHECK keeps going on failure so one run reports everything that broke.
+*/
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <Preferences.h>
+#include <stdio.h>
+
+namespace testing{
+
+typedef void (*TestFunction)();
+
+struct Registration
+{
+  Registration(const char *name, TestFunction function);
+};
+
+bool check(bool condition, const char *expression, const char *file, int line);
+bool checkEqual(long long actual, long long expected, const char *expression, const char *file, int line);
+bool checkString(const char *actual, const char *expected, const char *expression, const char *file, int line);
+
+//Benchmarks print their numbers with this, so ctest output shows them next to the result
+void report(const char *format, ...) __attribute__((format(printf, 1, 2)));
+
+};
+
+#define TEST(name) \
+  static void name(); \
+  static testing::Registration name##Registration(#name, name); \
+  static void name()
+
+#define CHECK(condition) testing::check((condition), #condition, __FILE__, __LINE__)
+#define CHECK_EQ(actual, expected) testing::checkEqual((long long)(actual), (long long)(expected), #actual " == " #expected, __FILE__, __LINE__)
+#define CHECK_STR(actual, expected) testing::checkString((actual), (expected), #actual " == " #expected, __FILE__, __LINE__)
@@ -0,0 +1,132 @@
+//Trace ring and the dump layout decode_trace.py reads
+
+#include "simulation.h"
+#include <string>
+
+using namespace EASYWIFI;
+using namespace testing;
+
+class Capture : public Print
+{
+  public:
+    size_t write(uint8_t byte) override { data.push_back(byte); return 1; };
+    size_t write(const uint8_t *buffer, size_t size) override { data.append(reinterpret_cast<const char*>(buffer), size); return size; };
+    std::string data;
+};
+
+//decode_trace.py unpacks "<IBBHII" and "<IBBHI"
+static_assert(sizeof(TraceDumpHeader) == 16, "TraceDumpHeader layout changed, update decode_trace.py");
+static_assert(sizeof(TraceRecord) == 12, "TraceRecord layout changed, update decode_trace.py");
+
+static TraceDumpHeader headerOf(const std::string &dump)
+{
+  TraceDumpHeader header = {};
+  if(dump.size() >= sizeof(header))
+    memcpy(&header, dump.data(), sizeof(header));
+  return header;
+}
+
+static TraceRecord recordOf(const std::string &dump, size_t index)
+{
+  TraceRecord record = {};
+  memcpy(&record, dump.data() + sizeof(TraceDumpHeader) + index * sizeof(TraceRecord), sizeof(record));
+  return record;
+}
+
+TEST(rawDumpListsRecordsOldestFirst)
+{
+  TraceBuffer trace;
+  fake::setMillis(5);
+  trace.record(TRACE_EVENT::BOOT);
+  fake::advance(1);
+  trace.record(TRACE_EVENT::SCAN_START, 2, 3);
+  fake::advance(1);
+  trace.record(TRACE_EVENT::CONNECT_DONE, 0, 0, 1234);
+
+  Capture out;
+  size_t written = trace.dump(out);
+  CHECK_EQ(written, out.data.size());
+  if(!CHECK_EQ(out.data.size(), sizeof(TraceDumpHeader) + 3 * sizeof(TraceRecord)))
+    return;
+
+  TraceDumpHeader header = headerOf(out.data);
+  CHECK_EQ(header.magic, TRACE_DUMP_MAGIC);
+  CHECK_EQ(header.version, TRACE_DUMP_VERSION);
+  CHECK_EQ(header.recordSize, sizeof(TraceRecord));
+  CHECK_EQ(header.count, 3);
+  CHECK_EQ(header.recorded, 3);
+  CHECK_EQ(header.now, 7000);
+
+  CHECK_EQ(recordOf(out.data, 0).event, (uint8_t)TRACE_EVENT::BOOT);
+  CHECK_EQ(recordOf(out.data, 0).time, 5000);
+  CHECK_EQ(recordOf(out.data, 1).arg8, 2);
+  CHECK_EQ(recordOf(out.data, 1).arg16, 3);
+  CHECK_EQ(recordOf(out.data, 2).arg32, 1234);
+}
+
+TEST(fullRingKeepsNewest)
+{
+  TraceBuffer trace;
+  for(uint32_t i = 0; i < TRACE_BUFFER_SIZE + 10; i++)
+    trace.record(TRACE_EVENT::REQUEST, 0, 0, i);
+
+  Capture out;
+  trace.dump(out);
+  TraceDumpHeader header = headerOf(out.data);
+  CHECK_EQ(header.count, TRACE_BUFFER_SIZE);
+  CHECK_EQ(header.recorded, TRACE_BUFFER_SIZE + 10);
+  CHECK_EQ(recordOf(out.data, 0).arg32, 10);
+  CHECK_EQ(recordOf(out.data, TRACE_BUFFER_SIZE - 1).arg32, TRACE_BUFFER_SIZE + 9);
+}
+
+TEST(hexDumpCarriesTheSameBytes)
+{
+  TraceBuffer trace;
+  for(uint8_t i = 0; i < 5; i++)
+    trace.record(TRACE_EVENT::SCAN_STEP, i, i * 2);
+
+  Capture raw, hex;
+  trace.dump(raw);
+  trace.dump(hex, true);
+
+  const std::string begin = "--- easyWifi trace ---\r\n";
+  const std::string end = "--- end of trace ---\r\n";
+  CHECK(hex.data.compare(0, begin.size(), begin) == 0);
+  CHECK(hex.data.size() > end.size() && hex.data.compare(hex.data.size() - end.size(), end.size(), end) == 0);
+
+  std::string bytes;
+  for(size_t i = begin.size(); i + 1 < hex.data.size() - end.size(); i++)
+  {
+    if(!isxdigit((unsigned char)hex.data[i]))
+      continue;
+    bytes.push_back((char)strtoul(hex.data.substr(i, 2).c_str(), nullptr, 16));
+    i++;
+  }
+  CHECK(bytes == raw.data);
+}
+
+TEST(easyWifiTracesItsFlow)
+{
+  addAccessPoint("home", 1, 6, -50, "homepass1");
+  EasyWifi wifi;
+  wifi.addCredential("home", "homepass1");
+  wifi.setup();
+  CHECK(runUntil(wifi, [&wifi]{ return wifi.get_WifiState() == WIFI_STATUS::CONNECTED; }, 20000));
+
+  Capture out;
+  wifi.dumpTrace(out, false);
+  TraceDumpHeader header = headerOf(out.data);
+  if(!CHECK(header.count >= 4))
+    return;
+
+  //Only what must be there, in order
+  const TRACE_EVENT expected[] = { TRACE_EVENT::BOOT, TRACE_EVENT::NVS_READ, TRACE_EVENT::CONNECT_START, TRACE_EVENT::CONNECT_DONE };
+  size_t next = 0;
+  for(size_t i = 0; i < header.count && next < sizeof(expected) / sizeof(expected[0]); i++)
+    if(recordOf(out.data, i).event == (uint8_t)expected[next])
+      next++;
+  CHECK_EQ(next, sizeof(expected) / sizeof(expected[0]));
+
+  //Passwords never reach the trace
+  CHECK(out.data.find("homepass1") == std::string::npos);
+}